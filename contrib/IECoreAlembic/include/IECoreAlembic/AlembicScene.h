@@ -109,6 +109,15 @@ class IECOREALEMBIC_API AlembicScene : public IECoreScene::SampledSceneInterface
 
 		void hash( HashType hashType, double time, IECore::MurmurHash &h ) const override;
 
+		/// Objects read via `readObjectAtSample()` are stored in a cache
+		/// shared by all AlembicScenes, keyed by the Alembic digest for
+		/// the object. The cache is limited to the specified memory usage
+		/// in bytes, which defaults to the value of the
+		/// IECOREALEMBIC_OBJECTCACHE_MEMORY environment variable (in megabytes),
+		/// or 500 megabytes if that is not set.
+		static void setObjectCacheMaxMemory( size_t maxMemory );
+		static size_t getObjectCacheMaxMemory();
+
 	private :
 
 		IE_CORE_FORWARDDECLARE( AlembicIO );
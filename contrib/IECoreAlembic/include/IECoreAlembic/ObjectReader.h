@@ -37,6 +37,8 @@
 
 #include "IECoreAlembic/Export.h"
 
+#include "IECoreScene/PrimitiveVariable.h"
+
 #include "IECore/Object.h"
 
 #include "Alembic/Abc/IObject.h"
@@ -65,6 +67,13 @@ class ObjectReader : private boost::noncopyable
 		virtual size_t readNumSamples() const = 0;
 		virtual Alembic::AbcCoreAbstract::TimeSamplingPtr readTimeSampling() const = 0;
 		virtual IECore::ObjectPtr readSample( const Alembic::Abc::ISampleSelector &sampleSelector ) const = 0;
+		/// Reads only the named primitive variables from a sample, returning
+		/// them as they would appear in the result of `readSample()`. Returns
+		/// an empty map if the object is not converted to a Primitive. The
+		/// default implementation reads the entire sample and discards the
+		/// unwanted variables, so derived classes should override it to read
+		/// only the data that is required.
+		virtual IECoreScene::PrimitiveVariableMap readPrimitiveVariables( const std::vector<IECore::InternedString> &primVarNames, const Alembic::Abc::ISampleSelector &sampleSelector ) const;
 
 		/// Factory function. Creates an ObjectReader for reading the specified
 		/// IObject and converting it to the specified cortex type. Returns null
@@ -39,8 +39,12 @@
 
 #include "IECoreScene/Primitive.h"
 
+#include "Alembic/Abc/ISampleSelector.h"
+#include "Alembic/AbcCoreAbstract/ArraySampleKey.h"
 #include "Alembic/AbcGeom/GeometryScope.h"
 
+#include "tbb/spin_mutex.h"
+
 namespace IECoreAlembic
 {
 
@@ -49,15 +53,36 @@ class PrimitiveReader : public ObjectReader
 
 	protected :
 
-		void readArbGeomParams( const Alembic::Abc::ICompoundProperty &params, const Alembic::Abc::ISampleSelector &sampleSelector, IECoreScene::Primitive *primitive ) const;
+		/// If `primVarNames` is specified, only the named parameters are read.
+		void readArbGeomParams( const Alembic::Abc::ICompoundProperty &params, const Alembic::Abc::ISampleSelector &sampleSelector, IECoreScene::Primitive *primitive, const std::vector<IECore::InternedString> *primVarNames = nullptr ) const;
 
 		template<typename T>
 		void readGeomParam( const T &param, const Alembic::Abc::ISampleSelector &sampleSelector, IECoreScene::Primitive *primitive ) const;
 
 		IECoreScene::PrimitiveVariable::Interpolation interpolation( Alembic::AbcGeom::GeometryScope scope ) const;
 
+		/// Remembers the most recent sample read from an array property,
+		/// so that it can be reused if the next sample is identical.
+		struct SampleCache
+		{
+			tbb::spin_mutex mutex;
+			Alembic::AbcCoreAbstract::ArraySampleKey key;
+			IECore::ConstDataPtr data;
+		};
+
+		/// Reads a sample from an array property, converting it to DataType.
+		/// If the sample's digest matches the one stored in `cache`, the cached
+		/// data is reused rather than being read and copied again. The result
+		/// is a lazy copy which shares its storage with the cached data, so
+		/// data which doesn't change between samples (typically topology and
+		/// UVs) is allocated only once, however many samples are read.
+		template<typename DataType, typename Property>
+		static typename DataType::Ptr readArraySample( const Property &property, const Alembic::Abc::ISampleSelector &sampleSelector, SampleCache &cache );
+
 };
 
 } // namespace IECoreAlembic
 
+#include "IECoreAlembic/PrimitiveReader.inl"
+
 #endif // IECOREALEMBIC_PRIMITIVEREADER_H
@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2019, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//
+//     * Neither the name of Image Engine Design nor the names of any
+//       other contributors to this software may be used to endorse or
+//       promote products derived from this software without specific prior
+//       written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef IECOREALEMBIC_PRIMITIVEREADER_INL
+#define IECOREALEMBIC_PRIMITIVEREADER_INL
+
+namespace IECoreAlembic
+{
+
+template<typename DataType, typename Property>
+typename DataType::Ptr PrimitiveReader::readArraySample( const Property &property, const Alembic::Abc::ISampleSelector &sampleSelector, SampleCache &cache )
+{
+	Alembic::AbcCoreAbstract::ArraySampleKey key;
+	const bool haveKey = property.getKey( key, sampleSelector );
+	if( haveKey )
+	{
+		tbb::spin_mutex::scoped_lock lock( cache.mutex );
+		if( cache.data && cache.key == key && cache.data->typeId() == DataType::staticTypeId() )
+		{
+			return boost::static_pointer_cast<DataType>( cache.data->copy() );
+		}
+	}
+
+	typename Property::sample_ptr_type sample;
+	property.get( sample, sampleSelector );
+
+	typename DataType::Ptr data = new DataType;
+	data->writable().assign( sample->get(), sample->get() + sample->size() );
+
+	if( haveKey )
+	{
+		IECore::ConstDataPtr cached = data->copy();
+		tbb::spin_mutex::scoped_lock lock( cache.mutex );
+		cache.key = key;
+		cache.data = cached;
+	}
+
+	return data;
+}
+
+} // namespace IECoreAlembic
+
+#endif // IECOREALEMBIC_PRIMITIVEREADER_INL
@@ -41,7 +41,9 @@
 
 #include "IECore/Exception.h"
 #include "IECore/IECore.h"
+#include "IECore/LRUCache.h"
 #include "IECore/MessageHandler.h"
+#include "IECore/ObjectInterpolator.h"
 #include "IECore/PathMatcherData.h"
 #include "IECore/SimpleTypedData.h"
 #include "IECore/TransformationMatrixData.h"
@@ -58,6 +60,7 @@
 #include "Alembic/AbcCollection/ICollections.h"
 #include "Alembic/AbcCollection/OCollections.h"
 
+#include "boost/lexical_cast.hpp"
 #include "boost/tokenizer.hpp"
 
 #include "tbb/spin_mutex.h"
@@ -116,6 +119,51 @@ GeometricData::Interpretation convertInterpretation( const std::string &interpre
 	return GeometricData::Interpretation::None;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Object cache
+//////////////////////////////////////////////////////////////////////////
+
+struct ObjectCacheGetterKey
+{
+
+	ObjectCacheGetterKey( const ObjectReader *reader, size_t sampleIndex, const IECore::MurmurHash &hash )
+		:	reader( reader ), sampleIndex( sampleIndex ), hash( hash )
+	{
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return hash;
+	}
+
+	const ObjectReader *reader;
+	size_t sampleIndex;
+	IECore::MurmurHash hash;
+
+};
+
+IECore::ConstObjectPtr objectCacheGetter( const ObjectCacheGetterKey &key, size_t &cost )
+{
+	IECore::ConstObjectPtr result = key.reader->readSample( key.sampleIndex );
+	cost = result ? result->memoryUsage() : 0;
+	return result;
+}
+
+typedef IECore::LRUCache<IECore::MurmurHash, IECore::ConstObjectPtr, IECore::LRUCachePolicy::Parallel, ObjectCacheGetterKey> ObjectCache;
+
+ObjectCache *createObjectCache()
+{
+	const char *m = getenv( "IECOREALEMBIC_OBJECTCACHE_MEMORY" );
+	size_t mb = m ? boost::lexical_cast<size_t>( m ) : 500;
+	return new ObjectCache( objectCacheGetter, 1024 * 1024 * mb );
+}
+
+ObjectCache &objectCache()
+{
+	static ObjectCache *c = createObjectCache();
+	return *c;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -1039,7 +1087,57 @@ class AlembicScene::AlembicReader : public AlembicIO
 
 		IECore::ConstObjectPtr objectAtSample( size_t sampleIndex ) const
 		{
-			return m_objectReader ? m_objectReader->readSample( sampleIndex ) : nullptr;
+			if( !m_objectReader )
+			{
+				return nullptr;
+			}
+
+			IECore::MurmurHash h;
+			if( !objectSampleHash( sampleIndex, h ) )
+			{
+				// Without a digest the hash can't distinguish between different
+				// versions of a file written to the same path, so caching could
+				// return stale objects.
+				return m_objectReader->readSample( sampleIndex );
+			}
+			return objectCache().get( ObjectCacheGetterKey( m_objectReader.get(), sampleIndex, h ) );
+		}
+
+		IECoreScene::PrimitiveVariableMap objectPrimitiveVariables( const std::vector<IECore::InternedString> &primVarNames, double time ) const
+		{
+			if( !m_objectReader )
+			{
+				return PrimitiveVariableMap();
+			}
+
+			size_t floorIndex, ceilIndex;
+			const double x = objectSampleInterval( time, floorIndex, ceilIndex );
+			PrimitiveVariableMap result = m_objectReader->readPrimitiveVariables( primVarNames, floorIndex );
+			if( x == 0.0 )
+			{
+				return result;
+			}
+
+			const PrimitiveVariableMap ceil = m_objectReader->readPrimitiveVariables( primVarNames, ceilIndex );
+			for( auto &v : result )
+			{
+				PrimitiveVariableMap::const_iterator it = ceil.find( v.first );
+				if( it == ceil.end() )
+				{
+					continue;
+				}
+				if( DataPtr d = runTimeCast<Data>( linearObjectInterpolation( v.second.data.get(), it->second.data.get(), x ) ) )
+				{
+					v.second.data = d;
+				}
+				else if( x >= 0.5 )
+				{
+					// Can't interpolate, so use the closest sample,
+					// as `SampledSceneInterface::readObject()` does.
+					v.second = it->second;
+				}
+			}
+			return result;
 		}
 
 		double objectSampleInterval( double time, size_t &floorIndex, size_t &ceilIndex ) const
@@ -1057,17 +1155,7 @@ class AlembicScene::AlembicReader : public AlembicIO
 		{
 			if( m_objectReader )
 			{
-				Alembic::Util::Digest digest;
-				if( const_cast<IObject &>( m_objectReader->object() ).getPropertiesHash( digest ) )
-				{
-					h.append( digest.words, 2 );
-				}
-				else
-				{
-					h.append( fileName() );
-					h.append( m_xform.getFullName() );
-				}
-
+				objectDigestHash( h );
 				if( m_objectReader->readNumSamples() > 1 )
 				{
 					h.append( time );
@@ -1075,6 +1163,21 @@ class AlembicScene::AlembicReader : public AlembicIO
 			}
 		}
 
+		// Hash uniquely identifying an object sample, used as the key for the
+		// object cache. Animated objects are keyed on sample index and static
+		// objects are not, so that all frames of a static object share a single
+		// cache entry. Returns false if the object has no digest, in which case
+		// the hash must not be used as a cache key.
+		bool objectSampleHash( size_t sampleIndex, IECore::MurmurHash &h ) const
+		{
+			const bool hasDigest = objectDigestHash( h );
+			if( m_objectReader->readNumSamples() > 1 )
+			{
+				h.append( (uint64_t)sampleIndex );
+			}
+			return hasDigest;
+		}
+
 		// Sets
 		// ====
 
@@ -1205,6 +1308,25 @@ class AlembicScene::AlembicReader : public AlembicIO
 			}
 		}
 
+		// Appends the digest of the object's properties to `h`, returning true
+		// on success. Archives without digests fall back to the file name and
+		// object path, and return false.
+		bool objectDigestHash( IECore::MurmurHash &h ) const
+		{
+			Alembic::Util::Digest digest;
+			if( const_cast<IObject &>( m_objectReader->object() ).getPropertiesHash( digest ) )
+			{
+				h.append( digest.words, 2 );
+				return true;
+			}
+			else
+			{
+				h.append( fileName() );
+				h.append( m_xform.getFullName() );
+				return false;
+			}
+		}
+
 		Abc::IBox3dProperty boundProperty() const
 		{
 			if( !m_xform )
@@ -2126,9 +2248,7 @@ IECore::ConstObjectPtr AlembicScene::readObjectAtSample( size_t sampleIndex ) co
 
 IECoreScene::PrimitiveVariableMap AlembicScene::readObjectPrimitiveVariables( const std::vector<IECore::InternedString> &primVarNames, double time ) const
 {
-	/// \todo I cannot find a single use of this function anywhere, but we've had to implement
-	/// it for no end of SceneInterface classes. Can we just remove it?
-	throw IECore::NotImplementedException( "AlembicScene::readObjectPrimitiveVariables" );
+	return reader()->objectPrimitiveVariables( primVarNames, time );
 }
 
 void AlembicScene::writeObject( const IECore::Object *object, double time )
@@ -2231,6 +2351,16 @@ void AlembicScene::hash( HashType hashType, double time, IECore::MurmurHash &h )
 	}
 }
 
+void AlembicScene::setObjectCacheMaxMemory( size_t maxMemory )
+{
+	objectCache().setMaxCost( maxMemory );
+}
+
+size_t AlembicScene::getObjectCacheMaxMemory()
+{
+	return objectCache().getMaxCost();
+}
+
 const AlembicScene::AlembicReader *AlembicScene::reader() const
 {
 	const AlembicReader *reader = dynamic_cast<const AlembicReader *>( m_io.get() );
@@ -75,6 +75,9 @@ CubicBasisf convertBasis( const ICurvesSchema::Sample &sample )
 	}
 }
 
+const InternedString g_P( "P" );
+const InternedString g_velocity( "velocity" );
+
 class CurvesReader : public PrimitiveReader
 {
 
@@ -110,12 +113,7 @@ class CurvesReader : public PrimitiveReader
 			const ICurvesSchema curvesSchema = m_curves.getSchema();
 			const ICurvesSchema::Sample sample = curvesSchema.getValue( sampleSelector );
 
-			IntVectorDataPtr vertsPerCurve = new IntVectorData;
-			vertsPerCurve->writable().insert(
-				vertsPerCurve->writable().end(),
-				sample.getCurvesNumVertices()->get(),
-				sample.getCurvesNumVertices()->get() + sample.getCurvesNumVertices()->size()
-			);
+			IntVectorDataPtr vertsPerCurve = readArraySample<IntVectorData>( curvesSchema.getNumVerticesProperty(), sampleSelector, m_vertsPerCurveCache );
 
 			V3fVectorDataPtr points = new V3fVectorData();
 			points->writable().resize( sample.getPositions()->size() );
@@ -144,9 +142,40 @@ class CurvesReader : public PrimitiveReader
 			return result;
 		}
 
+		IECoreScene::PrimitiveVariableMap readPrimitiveVariables( const std::vector<IECore::InternedString> &primVarNames, const Alembic::Abc::ISampleSelector &sampleSelector ) const override
+		{
+			const ICurvesSchema curvesSchema = m_curves.getSchema();
+			CurvesPrimitivePtr curves = new CurvesPrimitive;
+			for( const auto &name : primVarNames )
+			{
+				if( name == g_P )
+				{
+					Abc::P3fArraySamplePtr positions;
+					curvesSchema.getPositionsProperty().get( positions, sampleSelector );
+					V3fVectorDataPtr p = new V3fVectorData();
+					p->writable().assign( positions->get(), positions->get() + positions->size() );
+					p->setInterpretation( GeometricData::Point );
+					curves->variables["P"] = PrimitiveVariable( PrimitiveVariable::Vertex, p );
+				}
+				else if( name == g_velocity && curvesSchema.getVelocitiesProperty().valid() )
+				{
+					Abc::V3fArraySamplePtr velocities;
+					curvesSchema.getVelocitiesProperty().get( velocities, sampleSelector );
+					V3fVectorDataPtr velocityData = new V3fVectorData;
+					velocityData->writable().assign( velocities->get(), velocities->get() + velocities->size() );
+					velocityData->setInterpretation( GeometricData::Vector );
+					curves->variables["velocity"] = PrimitiveVariable( PrimitiveVariable::Vertex, velocityData );
+				}
+			}
+
+			readArbGeomParams( curvesSchema.getArbGeomParams(), sampleSelector, curves.get(), &primVarNames );
+			return curves->variables;
+		}
+
 	private :
 
 		const ICurves m_curves;
+		mutable SampleCache m_vertsPerCurveCache;
 
 		static Description<CurvesReader, ICurves> g_description;
 };
@@ -41,6 +41,8 @@
 #include "Alembic/AbcGeom/IPolyMesh.h"
 #include "Alembic/AbcGeom/ISubD.h"
 
+#include <algorithm>
+
 using namespace IECore;
 using namespace IECoreScene;
 using namespace IECoreAlembic;
@@ -49,6 +51,10 @@ using namespace Alembic::AbcGeom;
 namespace
 {
 
+const InternedString g_P( "P" );
+const InternedString g_velocity( "velocity" );
+const InternedString g_uv( "uv" );
+
 class MeshReader : public PrimitiveReader
 {
 
@@ -57,49 +63,17 @@ class MeshReader : public PrimitiveReader
 		template<typename Schema>
 		IECoreScene::MeshPrimitivePtr readTypedSample( const Schema &schema, const Alembic::Abc::ISampleSelector &sampleSelector ) const
 		{
-			Abc::Int32ArraySamplePtr faceCountsSample;
-			schema.getFaceCountsProperty().get( faceCountsSample, sampleSelector );
-
-			IntVectorDataPtr verticesPerFace = new IntVectorData();
-			verticesPerFace->writable().insert(
-				verticesPerFace->writable().begin(),
-				faceCountsSample->get(),
-				faceCountsSample->get() + faceCountsSample->size()
-			);
-
-			Abc::Int32ArraySamplePtr faceIndicesSample;
-			schema.getFaceIndicesProperty().get( faceIndicesSample, sampleSelector );
-
-			IntVectorDataPtr vertexIds = new IntVectorData();
-			vertexIds->writable().insert(
-				vertexIds->writable().begin(),
-				faceIndicesSample->get(),
-				faceIndicesSample->get() + faceIndicesSample->size()
-			);
-
-			Abc::P3fArraySamplePtr positionsSample;
-			schema.getPositionsProperty().get( positionsSample, sampleSelector );
-
-			V3fVectorDataPtr points = new V3fVectorData();
-			points->writable().resize( positionsSample->size() );
-			memcpy( &(points->writable()[0]), positionsSample->get(), positionsSample->size() * sizeof( Imath::V3f ) );
+			IntVectorDataPtr verticesPerFace = readArraySample<IntVectorData>( schema.getFaceCountsProperty(), sampleSelector, m_faceCountsCache );
+			IntVectorDataPtr vertexIds = readArraySample<IntVectorData>( schema.getFaceIndicesProperty(), sampleSelector, m_faceIndicesCache );
 
-			MeshPrimitivePtr result = new IECoreScene::MeshPrimitive( verticesPerFace, vertexIds, "linear", points );
+			MeshPrimitivePtr result = new IECoreScene::MeshPrimitive( verticesPerFace, vertexIds, "linear", readPositions( schema, sampleSelector ) );
 
 			Alembic::AbcGeom::IV2fGeomParam uvs = schema.getUVsParam();
 			readUVs( uvs, sampleSelector, result.get() );
 
 			if( schema.getVelocitiesProperty().valid() )
 			{
-				Abc::V3fArraySamplePtr velocitySample;
-				schema.getVelocitiesProperty().get( velocitySample, sampleSelector );
-
-				V3fVectorDataPtr velocityData = new V3fVectorData();
-				velocityData->writable().resize( velocitySample->size() );
-				memcpy( &(velocityData->writable()[0]), velocitySample->get(), velocitySample->size() * sizeof( Imath::V3f ) );
-
-				velocityData->setInterpretation( GeometricData::Vector );
-				result->variables["velocity"] = PrimitiveVariable( PrimitiveVariable::Vertex, velocityData );
+				result->variables["velocity"] = PrimitiveVariable( PrimitiveVariable::Vertex, readVelocities( schema, sampleSelector ) );
 			}
 
 			ICompoundProperty arbGeomParams = schema.getArbGeomParams();
@@ -108,8 +82,82 @@ class MeshReader : public PrimitiveReader
 			return result;
 		}
 
+		// Reads only the named primitive variables into `mesh`, which should
+		// have been default constructed. Topology is only read if it is needed
+		// to fix the winding order of FaceVarying variables - see `reverseWinding()`.
+		template<typename Schema>
+		void readTypedPrimitiveVariables( const Schema &schema, const std::vector<IECore::InternedString> &primVarNames, const Alembic::Abc::ISampleSelector &sampleSelector, IECoreScene::MeshPrimitive *mesh ) const
+		{
+			for( const auto &name : primVarNames )
+			{
+				if( name == g_P )
+				{
+					V3fVectorDataPtr p = readPositions( schema, sampleSelector );
+					p->setInterpretation( GeometricData::Point );
+					mesh->variables["P"] = PrimitiveVariable( PrimitiveVariable::Vertex, p );
+				}
+				else if( name == g_velocity && schema.getVelocitiesProperty().valid() )
+				{
+					mesh->variables["velocity"] = PrimitiveVariable( PrimitiveVariable::Vertex, readVelocities( schema, sampleSelector ) );
+				}
+				else if( name == g_uv )
+				{
+					readUVs( schema.getUVsParam(), sampleSelector, mesh );
+				}
+			}
+
+			readArbGeomParams( schema.getArbGeomParams(), sampleSelector, mesh, &primVarNames );
+		}
+
+		// Applies the same winding order reversal as `readSample()` to any
+		// FaceVarying variables in `mesh`, and returns the variables.
+		template<typename Schema>
+		IECoreScene::PrimitiveVariableMap reverseWinding( const Schema &schema, const Alembic::Abc::ISampleSelector &sampleSelector, IECoreScene::MeshPrimitive *mesh ) const
+		{
+			for( const auto &v : mesh->variables )
+			{
+				if( v.second.interpolation == PrimitiveVariable::FaceVarying )
+				{
+					mesh->setTopology(
+						readArraySample<IntVectorData>( schema.getFaceCountsProperty(), sampleSelector, m_faceCountsCache ),
+						readArraySample<IntVectorData>( schema.getFaceIndicesProperty(), sampleSelector, m_faceIndicesCache ),
+						"linear"
+					);
+					IECoreScene::MeshAlgo::reverseWinding( mesh );
+					break;
+				}
+			}
+			return mesh->variables;
+		}
+
 	private :
 
+		template<typename Schema>
+		static IECore::V3fVectorDataPtr readPositions( const Schema &schema, const Alembic::Abc::ISampleSelector &sampleSelector )
+		{
+			Abc::P3fArraySamplePtr positionsSample;
+			schema.getPositionsProperty().get( positionsSample, sampleSelector );
+
+			V3fVectorDataPtr points = new V3fVectorData();
+			points->writable().resize( positionsSample->size() );
+			memcpy( points->writable().data(), positionsSample->get(), positionsSample->size() * sizeof( Imath::V3f ) );
+			return points;
+		}
+
+		template<typename Schema>
+		static IECore::V3fVectorDataPtr readVelocities( const Schema &schema, const Alembic::Abc::ISampleSelector &sampleSelector )
+		{
+			Abc::V3fArraySamplePtr velocitySample;
+			schema.getVelocitiesProperty().get( velocitySample, sampleSelector );
+
+			V3fVectorDataPtr velocityData = new V3fVectorData();
+			velocityData->writable().resize( velocitySample->size() );
+			memcpy( velocityData->writable().data(), velocitySample->get(), velocitySample->size() * sizeof( Imath::V3f ) );
+
+			velocityData->setInterpretation( GeometricData::Vector );
+			return velocityData;
+		}
+
 		void readUVs( const Alembic::AbcGeom::IV2fGeomParam &uvs, const Alembic::Abc::ISampleSelector &sampleSelector, IECoreScene::Primitive *primitive ) const
 		{
 			if( !uvs.valid() )
@@ -117,37 +165,27 @@ class MeshReader : public PrimitiveReader
 				return;
 			}
 
-			typedef IV2fArrayProperty::sample_ptr_type SamplePtr;
-			auto uvParam = uvs.getIndexedValue( sampleSelector );
-			SamplePtr sample = uvParam.getVals();
-			size_t uvSize = sample->size();
-			V2fVectorDataPtr uvData = new V2fVectorData;
+			V2fVectorDataPtr uvData = readArraySample<V2fVectorData>( uvs.getValueProperty(), sampleSelector, m_uvCache );
 			uvData->setInterpretation( GeometricData::UV );
-			std::vector<Imath::V2f> &uvValues = uvData->writable();
-			uvValues.reserve( uvSize );
-			for( size_t i=0; i<uvSize; ++i )
-			{
-				uvValues.push_back( (*sample)[i] );
-			}
 
 			IntVectorDataPtr indexData = nullptr;
-			if( uvParam.isIndexed() )
+			if( uvs.isIndexed() )
 			{
-				UInt32ArraySamplePtr indices = uvParam.getIndices();
-				size_t indexSize = indices->size();
-				indexData = new IntVectorData;
-				std::vector<int> &indexValues = indexData->writable();
-				indexValues.reserve( indexSize );
-				for( size_t i = 0; i < indexSize; ++i )
-				{
-					indexValues.push_back( (*indices)[i] );
-				}
+				indexData = readArraySample<IntVectorData>( uvs.getIndexProperty(), sampleSelector, m_uvIndicesCache );
 			}
 
 			PrimitiveVariable::Interpolation interpolation = PrimitiveReader::interpolation( uvs.getScope() );
 			primitive->variables["uv"] = PrimitiveVariable( interpolation, uvData, indexData );
 		}
 
+		// Topology and UVs are typically constant, even on deforming
+		// meshes, so we cache them to avoid rereading them for every
+		// sample.
+		mutable SampleCache m_faceCountsCache;
+		mutable SampleCache m_faceIndicesCache;
+		mutable SampleCache m_uvCache;
+		mutable SampleCache m_uvIndicesCache;
+
 };
 
 class PolyMeshReader : public MeshReader
@@ -195,6 +233,21 @@ class PolyMeshReader : public MeshReader
 			return result;
 		}
 
+		IECoreScene::PrimitiveVariableMap readPrimitiveVariables( const std::vector<IECore::InternedString> &primVarNames, const Alembic::Abc::ISampleSelector &sampleSelector ) const override
+		{
+			const IPolyMeshSchema &schema = m_polyMesh.getSchema();
+			MeshPrimitivePtr mesh = new MeshPrimitive;
+			readTypedPrimitiveVariables( schema, primVarNames, sampleSelector, mesh.get() );
+
+			IN3fGeomParam normals = schema.getNormalsParam();
+			if( normals.valid() && std::find( primVarNames.begin(), primVarNames.end(), InternedString( normals.getHeader().getName() ) ) != primVarNames.end() )
+			{
+				readGeomParam( normals, sampleSelector, mesh.get() );
+			}
+
+			return reverseWinding( schema, sampleSelector, mesh.get() );
+		}
+
 	private :
 
 		const IPolyMesh m_polyMesh;
@@ -254,6 +307,14 @@ class SubDReader : public MeshReader
 			return result;
 		}
 
+		IECoreScene::PrimitiveVariableMap readPrimitiveVariables( const std::vector<IECore::InternedString> &primVarNames, const Alembic::Abc::ISampleSelector &sampleSelector ) const override
+		{
+			const ISubDSchema &schema = m_subD.getSchema();
+			MeshPrimitivePtr mesh = new MeshPrimitive;
+			readTypedPrimitiveVariables( schema, primVarNames, sampleSelector, mesh.get() );
+			return reverseWinding( schema, sampleSelector, mesh.get() );
+		}
+
 	private :
 
 		const ISubD m_subD;
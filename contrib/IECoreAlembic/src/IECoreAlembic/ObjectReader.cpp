@@ -34,7 +34,10 @@
 
 #include "IECoreAlembic/ObjectReader.h"
 
+#include "IECoreScene/Primitive.h"
+
 using namespace IECore;
+using namespace IECoreScene;
 using namespace IECoreAlembic;
 
 struct ObjectReader::Registration
@@ -48,6 +51,26 @@ ObjectReader::~ObjectReader()
 {
 }
 
+IECoreScene::PrimitiveVariableMap ObjectReader::readPrimitiveVariables( const std::vector<IECore::InternedString> &primVarNames, const Alembic::Abc::ISampleSelector &sampleSelector ) const
+{
+	PrimitiveVariableMap result;
+	ConstPrimitivePtr primitive = runTimeCast<const Primitive>( readSample( sampleSelector ) );
+	if( !primitive )
+	{
+		return result;
+	}
+
+	for( const auto &name : primVarNames )
+	{
+		PrimitiveVariableMap::const_iterator it = primitive->variables.find( name );
+		if( it != primitive->variables.end() )
+		{
+			result.insert( *it );
+		}
+	}
+	return result;
+}
+
 std::unique_ptr<ObjectReader> ObjectReader::create( const Alembic::Abc::IObject &object, IECore::TypeId cortexType )
 {
 	const Alembic::Abc::MetaData &md = object.getMetaData();
@@ -46,6 +46,10 @@ using namespace Alembic::AbcGeom;
 namespace
 {
 
+const InternedString g_P( "P" );
+const InternedString g_id( "id" );
+const InternedString g_velocity( "velocity" );
+
 class PointsReader : public PrimitiveReader
 {
 
@@ -108,6 +112,44 @@ class PointsReader : public PrimitiveReader
 			return result;
 		}
 
+		IECoreScene::PrimitiveVariableMap readPrimitiveVariables( const std::vector<IECore::InternedString> &primVarNames, const Alembic::Abc::ISampleSelector &sampleSelector ) const override
+		{
+			const IPointsSchema &pointsSchema = m_points.getSchema();
+			PointsPrimitivePtr points = new PointsPrimitive;
+			for( const auto &name : primVarNames )
+			{
+				if( name == g_P )
+				{
+					Abc::P3fArraySamplePtr positions;
+					pointsSchema.getPositionsProperty().get( positions, sampleSelector );
+					V3fVectorDataPtr p = new V3fVectorData();
+					p->writable().assign( positions->get(), positions->get() + positions->size() );
+					p->setInterpretation( GeometricData::Point );
+					points->variables["P"] = PrimitiveVariable( PrimitiveVariable::Vertex, p );
+				}
+				else if( name == g_id )
+				{
+					Abc::UInt64ArraySamplePtr ids;
+					pointsSchema.getIdsProperty().get( ids, sampleSelector );
+					UInt64VectorDataPtr id = new UInt64VectorData;
+					id->writable().assign( ids->get(), ids->get() + ids->size() );
+					points->variables["id"] = PrimitiveVariable( PrimitiveVariable::Vertex, id );
+				}
+				else if( name == g_velocity && pointsSchema.getVelocitiesProperty().valid() )
+				{
+					Abc::V3fArraySamplePtr velocities;
+					pointsSchema.getVelocitiesProperty().get( velocities, sampleSelector );
+					V3fVectorDataPtr velocityData = new V3fVectorData;
+					velocityData->writable().assign( velocities->get(), velocities->get() + velocities->size() );
+					velocityData->setInterpretation( GeometricData::Vector );
+					points->variables["velocity"] = PrimitiveVariable( PrimitiveVariable::Vertex, velocityData );
+				}
+			}
+
+			readArbGeomParams( pointsSchema.getArbGeomParams(), sampleSelector, points.get(), &primVarNames );
+			return points->variables;
+		}
+
 	private :
 
 		const IPoints m_points;
@@ -39,6 +39,8 @@
 
 #include "IECore/MessageHandler.h"
 
+#include <algorithm>
+
 using namespace Alembic::Abc;
 using namespace Alembic::AbcGeom;
 using namespace IECore;
@@ -89,7 +91,7 @@ struct ApplyGeometricInterpretation<GeometricTypedData<T>, GeomParam>
 // PrimitiveReader implementation
 //////////////////////////////////////////////////////////////////////////
 
-void PrimitiveReader::readArbGeomParams( const Alembic::Abc::ICompoundProperty &params, const Alembic::Abc::ISampleSelector &sampleSelector, IECoreScene::Primitive *primitive ) const
+void PrimitiveReader::readArbGeomParams( const Alembic::Abc::ICompoundProperty &params, const Alembic::Abc::ISampleSelector &sampleSelector, IECoreScene::Primitive *primitive, const std::vector<IECore::InternedString> *primVarNames ) const
 {
 	if( !params.valid() )
 	{
@@ -100,6 +102,11 @@ void PrimitiveReader::readArbGeomParams( const Alembic::Abc::ICompoundProperty &
 	{
 		const PropertyHeader &header = params.getPropertyHeader( i );
 
+		if( primVarNames && std::find( primVarNames->begin(), primVarNames->end(), InternedString( header.getName() ) ) == primVarNames->end() )
+		{
+			continue;
+		}
+
 		if( IFloatGeomParam::matches( header ) )
 		{
 			IFloatGeomParam p( params, header.getName() );
@@ -45,6 +45,8 @@ BOOST_PYTHON_MODULE( _IECoreAlembic )
 
 	IECorePython::RunTimeTypedClass<IECoreAlembic::AlembicScene>()
 		.def( init<const std::string &, IECore::IndexedIO::OpenMode>() )
+		.def( "setObjectCacheMaxMemory", &IECoreAlembic::AlembicScene::setObjectCacheMaxMemory ).staticmethod( "setObjectCacheMaxMemory" )
+		.def( "getObjectCacheMaxMemory", &IECoreAlembic::AlembicScene::getObjectCacheMaxMemory ).staticmethod( "getObjectCacheMaxMemory" )
 	;
 
 }
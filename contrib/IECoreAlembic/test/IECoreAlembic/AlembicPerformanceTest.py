@@ -156,3 +156,41 @@ class AlembicPerformanceTest( unittest.TestCase ) :
 			print times
 
 
+
+	@unittest.skipUnless( os.environ.get("IE_PERFORMANCE_TEST", False), "'IE_PERFORMANCE_TEST' env var not set" )
+	def testReadObjectPrimitiveVariables( self ) :
+
+		with tempfile.NamedTemporaryFile( suffix = ".abc" ) as tf:
+			fileName = tf.name
+
+		mesh = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ), imath.V2i( 500 ) )
+		numFrames = 48
+
+		with Timer( "write deforming mesh, filename: '{0}'".format( fileName ) ) :
+			root = IECoreScene.SceneInterface.create( fileName, IECore.IndexedIO.OpenMode.Write )
+			child = root.createChild( "plane" )
+			for frame in range( numFrames ) :
+				mesh["P"] = IECoreScene.PrimitiveVariable(
+					IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+					IECore.V3fVectorData( [ p + imath.V3f( 0, 0, frame ) for p in mesh["P"].data ], IECore.GeometricData.Interpretation.Point )
+				)
+				child.writeObject( mesh, frame / 24.0 )
+			del root, child
+
+		self.filesCreated.append( fileName )
+
+		root = IECoreScene.SceneInterface.create( fileName, IECore.IndexedIO.OpenMode.Read )
+		child = root.child( "plane" )
+
+		originalMaxMemory = IECoreAlembic.AlembicScene.getObjectCacheMaxMemory()
+		IECoreAlembic.AlembicScene.setObjectCacheMaxMemory( 0 )
+		try :
+			with Timer( "readObject for {0} frames".format( numFrames ) ) :
+				for frame in range( numFrames ) :
+					child.readObject( frame / 24.0 )
+
+			with Timer( "readObjectPrimitiveVariables( [ 'P' ] ) for {0} frames".format( numFrames ) ) :
+				for frame in range( numFrames ) :
+					child.readObjectPrimitiveVariables( [ "P" ], frame / 24.0 )
+		finally :
+			IECoreAlembic.AlembicScene.setObjectCacheMaxMemory( originalMaxMemory )
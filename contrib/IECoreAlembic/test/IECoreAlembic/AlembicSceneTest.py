@@ -1254,6 +1254,88 @@ class AlembicSceneTest( unittest.TestCase ) :
 		self.assertEqual( c.readObjectAtSample( 0 ), o1 )
 		self.assertEqual( c.readObjectAtSample( 1 ), o2 )
 
+	def testDeformingMeshTopology( self ) :
+
+		plane = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ), imath.V2i( 4 ) )
+		box = IECoreScene.MeshPrimitive.createBox( imath.Box3f( imath.V3f( -1 ), imath.V3f( 1 ) ) )
+
+		meshes = []
+		for i in range( 0, 6 ) :
+			# Constant topology for the first few samples, then
+			# a change of topology, then back again.
+			m = ( box if i == 3 else plane ).copy()
+			m["P"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.V3fVectorData( [ p + imath.V3f( 0, 0, i ) for p in m["P"].data ] ) )
+			meshes.append( m )
+
+		a = IECoreAlembic.AlembicScene( "/tmp/test.abc", IECore.IndexedIO.OpenMode.Write )
+		c = a.createChild( "o" )
+		for i, m in enumerate( meshes ) :
+			c.writeObject( m, i )
+		del a, c
+
+		a = IECoreAlembic.AlembicScene( "/tmp/test.abc", IECore.IndexedIO.OpenMode.Read )
+		c = a.child( "o" )
+		r0 = c.readObjectAtSample( 0 )
+
+		for i, m in enumerate( meshes ) :
+			r = c.readObjectAtSample( i )
+			self.assertEqual( r.verticesPerFace, m.verticesPerFace )
+			self.assertEqual( r.vertexIds, m.vertexIds )
+			self.assertEqual( r["P"], m["P"] )
+			self.assertEqual( r["uv"], m["uv"] )
+			# Modifying the result must not affect the topology
+			# shared with subsequent reads.
+			r.vertexIds[0] = 1000
+			r["uv"].data[0] = imath.V2f( 1000 )
+
+		self.assertEqual( c.readObjectAtSample( 0 ), r0 )
+
+	def testReadObjectPrimitiveVariables( self ) :
+
+		def assertPrimitiveVariablesEqual( scene, names, time ) :
+
+			o = scene.readObject( time )
+			v = scene.readObjectPrimitiveVariables( names, time )
+			self.assertEqual( set( v.keys() ), set( n for n in names if n in o ) )
+			for n in v.keys() :
+				self.assertEqual( v[n], o[n] )
+
+		a = IECoreScene.SceneInterface.create( os.path.dirname( __file__ ) + "/data/animatedCube.abc", IECore.IndexedIO.OpenMode.Read )
+		m = a.child( "pCube1" )
+		for time in ( 0, 1 / 24.0, 1.5 / 24.0, 2 / 24.0 ) :
+			assertPrimitiveVariablesEqual( m, [ "P" ], time )
+			assertPrimitiveVariablesEqual( m, [ "P", "N", "uv", "notAPrimVar" ], time )
+
+		a = IECoreScene.SceneInterface.create( os.path.dirname( __file__ ) + "/data/coloredMesh.abc", IECore.IndexedIO.OpenMode.Read )
+		m = a.child( "pPlane1" )
+		assertPrimitiveVariablesEqual( m, [ "uv", "colorSet1" ], 0 )
+
+		a = IECoreScene.SceneInterface.create( os.path.dirname( __file__ ) + "/data/subdPlane.abc", IECore.IndexedIO.OpenMode.Read )
+		m = a.child( "pPlane1" )
+		assertPrimitiveVariablesEqual( m, [ "P", "uv" ], 0 )
+
+		a = IECoreScene.SceneInterface.create( os.path.dirname( __file__ ) + "/data/points.abc", IECore.IndexedIO.OpenMode.Read )
+		p = a.child( "particle1" )
+		time = p.sampleTime( 9 )
+		assertPrimitiveVariablesEqual( p, [ "P", "velocity", "id" ], time )
+
+		a = IECoreScene.SceneInterface.create( os.path.dirname( __file__ ) + "/data/curves.abc", IECore.IndexedIO.OpenMode.Read )
+		c = a.child( "curve" )
+		assertPrimitiveVariablesEqual( c, [ "P" ], 0 )
+
+	def testObjectCacheMaxMemory( self ) :
+
+		original = IECoreAlembic.AlembicScene.getObjectCacheMaxMemory()
+		try :
+			IECoreAlembic.AlembicScene.setObjectCacheMaxMemory( 1024 )
+			self.assertEqual( IECoreAlembic.AlembicScene.getObjectCacheMaxMemory(), 1024 )
+
+			a = IECoreScene.SceneInterface.create( os.path.dirname( __file__ ) + "/data/animatedCube.abc", IECore.IndexedIO.OpenMode.Read )
+			m = a.child( "pCube1" )
+			self.assertEqual( m.readObjectAtSample( 1 ), m.readObjectAtSample( 1 ) )
+		finally :
+			IECoreAlembic.AlembicScene.setObjectCacheMaxMemory( original )
+
 	def testWritePointsWithoutIDs( self ):
 
 		# IDs a required by alembic and are  generated in the writer if they're not present
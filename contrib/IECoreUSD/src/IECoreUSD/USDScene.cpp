@@ -58,6 +58,7 @@ IECORE_PUSH_DEFAULT_VISIBILITY
 #include "pxr/usd/usdGeom/points.h"
 #include "pxr/usd/usdGeom/tokens.h"
 #include "pxr/usd/usdGeom/xform.h"
+#include "pxr/usd/usdGeom/xformCache.h"
 #include "pxr/usd/usdGeom/camera.h"
 IECORE_POP_DEFAULT_VISIBILITY
 
@@ -68,6 +69,11 @@ IECORE_POP_DEFAULT_VISIBILITY
 #include "boost/format.hpp"
 #include "boost/functional/hash.hpp"
 
+#include "tbb/concurrent_unordered_map.h"
+#include "tbb/enumerable_thread_specific.h"
+
+#include "OpenEXR/ImathBoxAlgo.h"
+
 #include <iostream>
 
 using namespace IECore;
@@ -1298,6 +1304,73 @@ bool isAttributeName( const pxr::TfToken& attributeName )
 	return boost::algorithm::starts_with( attributeName.GetString(), "cortex:" );
 }
 
+bool isZUp( const pxr::UsdStageWeakPtr &stage )
+{
+	return pxr::UsdGeomGetStageUpAxis( stage ) == pxr::UsdGeomTokens->z;
+}
+
+// Converts from the Z-up space of the stage to the Y-up space
+// we present via the SceneInterface. Applied to the transforms
+// of the top level prims.
+const Imath::M44d &zUpToYUp()
+{
+	static Imath::M44d b
+		(
+			0, 0, 1, 0,
+			1, 0, 0, 0,
+			0, 1, 0, 0,
+			0, 0, 0, 1
+		);
+	return b;
+}
+
+const pxr::TfTokenVector &boundPurposes()
+{
+	// We convert prims regardless of their purpose, so bounds must
+	// include all of them.
+	static pxr::TfTokenVector g_purposes = {
+		pxr::UsdGeomTokens->default_,
+		pxr::UsdGeomTokens->render,
+		pxr::UsdGeomTokens->proxy,
+		pxr::UsdGeomTokens->guide
+	};
+	return g_purposes;
+}
+
+Imath::Box3d computeBound( pxr::UsdGeomBBoxCache &bboxCache, const pxr::UsdPrim &prim, bool zUp )
+{
+	const pxr::GfRange3d range = bboxCache.ComputeUntransformedBound( prim ).ComputeAlignedRange();
+	if( range.IsEmpty() )
+	{
+		return Imath::Box3d();
+	}
+
+	Imath::Box3d result;
+	convert( result.min, range.GetMin() );
+	convert( result.max, range.GetMax() );
+
+	if( zUp && prim.IsPseudoRoot() )
+	{
+		result = Imath::transform( result, zUpToYUp() );
+	}
+
+	return result;
+}
+
+Imath::M44d computeLocalTransform( pxr::UsdGeomXformCache &xformCache, const pxr::UsdPrim &prim, bool zUp )
+{
+	bool reset = false;
+	Imath::M44d result;
+	convert( result, xformCache.GetLocalTransformation( prim, &reset ) );
+
+	if( zUp && prim.GetParent().IsPseudoRoot() )
+	{
+		result = result * zUpToYUp();
+	}
+
+	return result;
+}
+
 } // namespace
 
 
@@ -1329,6 +1402,25 @@ class USDScene::IO : public RefCounted
 
 		virtual bool isReader() const = 0;
 
+		/// Returns the bound of `prim` and its descendants, in the local
+		/// space of `prim`.
+		virtual Imath::Box3d bound( const pxr::UsdPrim &prim, pxr::UsdTimeCode time ) const
+		{
+			pxr::UsdGeomBBoxCache bboxCache( time, boundPurposes(), /* useExtentsHint = */ true );
+			return computeBound( bboxCache, prim, isZUp( m_usdStage ) );
+		}
+
+		virtual Imath::M44d localTransform( const pxr::UsdPrim &prim, pxr::UsdTimeCode time ) const
+		{
+			pxr::UsdGeomXformCache xformCache( time );
+			return computeLocalTransform( xformCache, prim, isZUp( m_usdStage ) );
+		}
+
+		virtual bool boundMightBeTimeVarying( const pxr::UsdPrim &prim ) const
+		{
+			return true;
+		}
+
 		pxr::UsdStageRefPtr getStage() const { return m_usdStage; }
 	protected:
 		pxr::UsdStageRefPtr m_usdStage;
@@ -1351,6 +1443,7 @@ class USDScene::Reader : public USDScene::IO
 
 			m_timeCodesPerSecond = m_usdStage->GetTimeCodesPerSecond();
 			m_rootPrim = m_usdStage->GetPseudoRoot();
+			m_zUp = isZUp( m_usdStage );
 		}
 
 		pxr::UsdPrim root() const override
@@ -1365,11 +1458,141 @@ class USDScene::Reader : public USDScene::IO
 
 		bool isReader()  const override { return true; }
 
+		Imath::Box3d bound( const pxr::UsdPrim &prim, pxr::UsdTimeCode time ) const override
+		{
+			ThreadCaches &threadCaches = m_threadCaches.local();
+			if( threadCaches.inUse )
+			{
+				return IO::bound( prim, time );
+			}
+
+			ThreadCaches::Scope scope( threadCaches );
+			return computeBound( threadCaches.get( time ).bboxCache, prim, m_zUp );
+		}
+
+		Imath::M44d localTransform( const pxr::UsdPrim &prim, pxr::UsdTimeCode time ) const override
+		{
+			ThreadCaches &threadCaches = m_threadCaches.local();
+			if( threadCaches.inUse )
+			{
+				return IO::localTransform( prim, time );
+			}
+
+			ThreadCaches::Scope scope( threadCaches );
+			return computeLocalTransform( threadCaches.get( time ).xformCache, prim, m_zUp );
+		}
+
+		bool boundMightBeTimeVarying( const pxr::UsdPrim &prim ) const override
+		{
+			const pxr::SdfPath &path = prim.GetPath();
+			auto it = m_boundVariability.find( path );
+			if( it != m_boundVariability.end() )
+			{
+				return it->second;
+			}
+
+			bool result = false;
+			if( pxr::UsdGeomBoundable boundable = pxr::UsdGeomBoundable( prim ) )
+			{
+				pxr::UsdAttribute extentAttr = boundable.GetExtentAttr();
+				if( extentAttr.HasAuthoredValue() )
+				{
+					result = extentAttr.ValueMightBeTimeVarying();
+				}
+				else
+				{
+					result = isTimeVarying( prim );
+				}
+			}
+
+			if( !result )
+			{
+				for( const auto &child : prim.GetChildren() )
+				{
+					pxr::UsdGeomXformable xformable( child );
+					if( ( xformable && xformable.TransformMightBeTimeVarying() ) || boundMightBeTimeVarying( child ) )
+					{
+						result = true;
+						break;
+					}
+				}
+			}
+
+			m_boundVariability.insert( std::make_pair( path, result ) );
+			return result;
+		}
+
 	private:
 
 		pxr::UsdPrim m_rootPrim;
 
 		double m_timeCodesPerSecond;
+		bool m_zUp;
+
+		// UsdGeomXformCache and UsdGeomBBoxCache are not threadsafe, so
+		// we maintain a set per thread, allowing concurrent traversal
+		// without locking. Caches for the most recently used times are
+		// kept, so that interleaved queries at several times (as when
+		// computing motion blur) don't discard each other's results.
+		struct TimeCaches
+		{
+			TimeCaches( pxr::UsdTimeCode time )
+				:	time( time ), xformCache( time ), bboxCache( time, boundPurposes(), /* useExtentsHint = */ true )
+			{
+			}
+
+			pxr::UsdTimeCode time;
+			pxr::UsdGeomXformCache xformCache;
+			pxr::UsdGeomBBoxCache bboxCache;
+		};
+
+		struct ThreadCaches
+		{
+
+			ThreadCaches()
+				:	inUse( false )
+			{
+			}
+
+			TimeCaches &get( pxr::UsdTimeCode time )
+			{
+				for( const auto &c : timeCaches )
+				{
+					if( c->time == time )
+					{
+						return *c;
+					}
+				}
+
+				if( timeCaches.size() >= maxTimes )
+				{
+					timeCaches.erase( timeCaches.begin() );
+				}
+				timeCaches.emplace_back( new TimeCaches( time ) );
+				return *timeCaches.back();
+			}
+
+			// UsdGeomBBoxCache uses TBB internally, so this thread may
+			// pick up another of our tasks while waiting for it, and
+			// re-enter the Reader. We must not modify the caches in that
+			// case, so we flag them as in use and fall back to temporary
+			// caches for any nested calls.
+			struct Scope
+			{
+				Scope( ThreadCaches &caches ) : m_caches( caches ) { m_caches.inUse = true; }
+				~Scope() { m_caches.inUse = false; }
+				private :
+					ThreadCaches &m_caches;
+			};
+
+			static const size_t maxTimes = 4;
+			std::vector<std::unique_ptr<TimeCaches>> timeCaches;
+			bool inUse;
+
+		};
+
+		mutable tbb::enumerable_thread_specific<ThreadCaches> m_threadCaches;
+		mutable tbb::concurrent_unordered_map<pxr::SdfPath, bool, pxr::SdfPath::Hash> m_boundVariability;
 };
 
 class USDScene::Writer : public USDScene::IO
@@ -1439,35 +1662,7 @@ std::string USDScene::fileName() const
 
 Imath::Box3d USDScene::readBound( double time ) const
 {
-	pxr::UsdGeomBoundable boundable = pxr::UsdGeomBoundable( m_location->prim );
-	pxr::UsdGeomMesh mesh = pxr::UsdGeomMesh ( m_location->prim );
-
-	if( !boundable )
-	{
-		return Imath::Box3d();
-	}
-
-	pxr::UsdAttribute attr = boundable.GetExtentAttr();
-
-	if( !attr.IsValid() )
-	{
-		return Imath::Box3d();
-	}
-
-	pxr::VtArray<pxr::GfVec3f> extents;
-	attr.Get<pxr::VtArray<pxr::GfVec3f> >( &extents, m_root->getTime( time ) );
-
-	if( extents.size() == 2 )
-	{
-		Imath::V3f min;
-		convert( min, extents[0] );
-
-		Imath::V3f max;
-		convert( max, extents[1] );
-		return Imath::Box3d( min, max );
-	}
-
-	return Imath::Box3d();
+	return m_root->bound( m_location->prim, m_root->getTime( time ) );
 }
 
 ConstDataPtr USDScene::readTransform( double time ) const
@@ -1477,29 +1672,7 @@ ConstDataPtr USDScene::readTransform( double time ) const
 
 Imath::M44d USDScene::readTransformAsMatrix( double time ) const
 {
-	bool zUp = m_location->prim.GetParent().IsPseudoRoot() && pxr::UsdGeomGetStageUpAxis( m_root->getStage() ) == pxr::UsdGeomTokens->z;
-
-	pxr::UsdGeomXformable transformable( m_location->prim );
-	pxr::GfMatrix4d transform;
-	bool reset = false;
-
-	transformable.GetLocalTransformation( &transform, &reset, m_root->getTime( time ) );
-	Imath::M44d returnValue;
-	convert( returnValue, transform );
-
-	if ( zUp )
-	{
-		static Imath::M44d b
-			(
-				0, 0, 1, 0,
-				1, 0, 0, 0,
-				0, 1, 0, 0,
-				0, 0, 0, 1
-			);
-
-		returnValue = returnValue * b;
-	}
-	return returnValue;
+	return m_root->localTransform( m_location->prim, m_root->getTime( time ) );
 }
 
 ConstObjectPtr USDScene::readAttribute( const SceneInterface::Name &name, double time ) const
@@ -1576,6 +1749,13 @@ void USDScene::path( SceneInterface::Path &p ) const
 
 bool USDScene::hasBound() const
 {
+	if( m_root->isReader() )
+	{
+		// Bounds are computed for all locations, whether
+		// or not they have an authored extent.
+		return true;
+	}
+
 	pxr::UsdGeomBoundable boundable = pxr::UsdGeomBoundable( m_location->prim );
 	pxr::UsdGeomMesh mesh = pxr::UsdGeomMesh( m_location->prim );
 	pxr::UsdAttribute attr;
@@ -2104,15 +2284,12 @@ void USDScene::hash( SceneInterface::HashType hashType, double time, MurmurHash
 
 void USDScene::boundHash( double time, IECore::MurmurHash &h ) const
 {
-	if( pxr::UsdGeomBoundable boundable = pxr::UsdGeomBoundable( m_location->prim ) )
-	{
-		h.append( m_location->prim.GetPath().GetString() );
-		h.append( m_root->fileName() );
+	h.append( m_location->prim.GetPath().GetString() );
+	h.append( m_root->fileName() );
 
-		if( boundable.GetExtentAttr().ValueMightBeTimeVarying() )
-		{
-			h.append( time );
-		}
+	if( m_root->boundMightBeTimeVarying( m_location->prim ) )
+	{
+		h.append( time );
 	}
 }
 
@@ -192,6 +192,53 @@ class USDSceneTest( unittest.TestCase ) :
 
 		self.assertEqual( bound, imath.Box3d( imath.V3d( -0.5 ), imath.V3d( 0.5 ) ) )
 
+	def testComputedBounds( self ) :
+
+		root = IECoreScene.SceneInterface.create( os.path.dirname( __file__ ) + "/data/hierarchy.usda", IECore.IndexedIO.OpenMode.Read )
+		group1 = root.child( "group1" )
+		group2 = group1.child( "group2" )
+		plane = group1.child( "pPlane1" )
+		cube = group2.child( "pCube1" )
+
+		self.assertTrue( group1.hasBound() )
+		self.assertTrue( group2.hasBound() )
+
+		self.assertEqual( cube.readBound( 0.0 ), imath.Box3d( imath.V3d( -0.5 ), imath.V3d( 0.5 ) ) )
+		self.assertEqual( group2.readBound( 0.0 ), cube.readBound( 0.0 ) )
+
+		# Union of the cube and the plane, which is translated by 2 in X.
+		expectedBound = imath.Box3d( imath.V3d( -0.5 ), imath.V3d( 2.5, 0.5, 0.5 ) )
+
+		self.assertEqual( group1.readBound( 0.0 ), expectedBound )
+		self.assertEqual( root.readBound( 0.0 ), expectedBound )
+
+	def testAnimatedBoundHashes( self ) :
+
+		root = IECoreScene.SceneInterface.create( os.path.dirname( __file__ ) + "/data/hierarchy.usda", IECore.IndexedIO.OpenMode.Read )
+		self.assertEqual( root.hash( root.HashType.BoundHash, 0 ), root.hash( root.HashType.BoundHash, 1 ) )
+
+		for fileName in ( "transformAnim.usda", "vertexAnim.usda" ) :
+			root = IECoreScene.SceneInterface.create( os.path.dirname( __file__ ) + "/data/" + fileName, IECore.IndexedIO.OpenMode.Read )
+			self.assertNotEqual( root.hash( root.HashType.BoundHash, 0 ), root.hash( root.HashType.BoundHash, 1 ) )
+
+	def testParallelTraversal( self ) :
+
+		fileName = os.path.dirname( __file__ ) + "/data/hierarchy.usda"
+
+		def readAll( scene, time, result ) :
+
+			result[tuple( scene.path() )] = ( scene.readBound( time ), scene.readTransformAsMatrix( time ) )
+			for childName in scene.childNames() :
+				readAll( scene.child( childName ), time, result )
+
+			return result
+
+		expected = readAll( IECoreScene.SceneInterface.create( fileName, IECore.IndexedIO.OpenMode.Read ), 0.0, {} )
+
+		root = IECoreScene.SceneInterface.create( fileName, IECore.IndexedIO.OpenMode.Read )
+		IECoreScene.SceneAlgo.parallelReadAll( root, 0, 10, 24.0, IECoreScene.SceneAlgo.ProcessFlags.Bounds | IECoreScene.SceneAlgo.ProcessFlags.Transforms )
+		self.assertEqual( readAll( root, 0.0, {} ), expected )
+
 	def testTransform ( self ) :
 
 		root = IECoreScene.SceneInterface.create( os.path.dirname( __file__ ) + "/data/hierarchy.usda", IECore.IndexedIO.OpenMode.Read )
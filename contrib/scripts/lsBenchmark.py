@@ -0,0 +1,126 @@
+from __future__ import print_function
+
+import os
+import sys
+import json
+import time
+import shutil
+import inspect
+import argparse
+import tempfile
+
+import IECore
+
+parser = argparse.ArgumentParser(
+	description = inspect.cleandoc(
+	"""
+	Benchmarks IECore.ls() and IECore.findSequences() on synthetic
+	directories containing large numbers of frames, reporting the time
+	taken to list the directories one at a time and in parallel.
+
+	Results can be written as JSON so that they may be compared across
+	Cortex releases to track regressions.
+	""" ),
+	formatter_class = argparse.RawTextHelpFormatter
+)
+
+parser.add_argument(
+	"--directories",
+	help = "The number of directories to create.",
+	type = int,
+	default = 4,
+)
+
+parser.add_argument(
+	"--sequences",
+	help = "The number of sequences to create in each directory.",
+	type = int,
+	default = 10,
+)
+
+parser.add_argument(
+	"--frames",
+	help = "The number of frames in each sequence.",
+	type = int,
+	default = 10000,
+)
+
+parser.add_argument(
+	"--root",
+	help = "The directory in which to create the test directories.\n"
+		"Defaults to a temporary directory which is removed afterwards.",
+)
+
+parser.add_argument(
+	"--repeats",
+	help = "The number of times to repeat each test.",
+	type = int,
+	default = 3,
+)
+
+parser.add_argument(
+	"--json",
+	help = "A file to write the results to.",
+)
+
+args = parser.parse_args()
+
+def makeDirectories( root ) :
+
+	directories = []
+	for d in range( 0, args.directories ) :
+		directory = os.path.join( root, "shot{0:03d}".format( d ) )
+		if not os.path.isdir( directory ) :
+			os.makedirs( directory )
+		for s in range( 0, args.sequences ) :
+			sequence = IECore.FileSequence( "layer{0:02d}.####.exr".format( s ), IECore.FrameRange( 1, args.frames ) )
+			for f in sequence.fileNames() :
+				fileName = os.path.join( directory, f )
+				if not os.path.exists( fileName ) :
+					open( fileName, "w" ).close()
+		directories.append( directory )
+
+	return directories
+
+def timed( f ) :
+
+	times = []
+	for i in range( 0, args.repeats ) :
+		t = time.time()
+		f()
+		times.append( time.time() - t )
+
+	return min( times )
+
+def benchmark( directories ) :
+
+	names = os.listdir( directories[0] )
+	numFiles = args.directories * args.sequences * args.frames
+
+	results = {
+		"directories" : args.directories,
+		"sequences" : args.sequences,
+		"frames" : args.frames,
+		"findSequences" : timed( lambda : IECore.findSequences( names ) ),
+		"lsSerial" : timed( lambda : [ IECore.ls( d ) for d in directories ] ),
+		"lsParallel" : timed( lambda : IECore.ls( directories ) ),
+	}
+
+	print( "{0} directories, {1} files".format( args.directories, numFiles ) )
+	print( "    findSequences : {0:.3f}s ({1} names)".format( results["findSequences"], len( names ) ) )
+	for key in ( "lsSerial", "lsParallel" ) :
+		print( "    {0:<13} : {1:.3f}s ({2:.0f} files/s)".format( key, results[key], numFiles / results[key] if results[key] else 0 ) )
+	sys.stdout.flush()
+
+	return results
+
+root = args.root or tempfile.mkdtemp( prefix = "lsBenchmark" )
+try :
+	results = benchmark( makeDirectories( root ) )
+finally :
+	if not args.root :
+		shutil.rmtree( root )
+
+if args.json :
+	with open( args.json, "w" ) as f :
+		json.dump( results, f, indent = 4, sort_keys = True )
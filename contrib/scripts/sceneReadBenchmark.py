@@ -0,0 +1,168 @@
+from __future__ import print_function
+
+import os
+import sys
+import json
+import inspect
+import argparse
+
+import IECore
+import IECoreScene
+
+parser = argparse.ArgumentParser(
+	description = inspect.cleandoc(
+	"""
+	Benchmarks the reading of scenes (.scc, .abc, .usd or any other
+	format supported by SceneInterface) using SceneAlgo.parallelReadAll(),
+	reporting throughput, bytes loaded into memory and per-stage timings for each
+	combination of file, thread count and frame parallelism.
+
+	Results can be written as JSON so that they may be compared across
+	Cortex releases to track regressions.
+	""" ),
+	formatter_class = argparse.RawTextHelpFormatter
+)
+
+parser.add_argument(
+	"files",
+	help = "The scene files to read.",
+	nargs = "+",
+)
+
+parser.add_argument(
+	"--frames",
+	help = "The first and last frames to read.",
+	nargs = 2,
+	type = int,
+	default = [ 1, 1 ],
+)
+
+parser.add_argument(
+	"--frameRate",
+	help = "The frame rate used to convert frames to times.",
+	type = float,
+	default = 24.0,
+)
+
+parser.add_argument(
+	"--threads",
+	help = "The thread counts to benchmark. Zero uses the default.",
+	nargs = "+",
+	type = int,
+	default = [ 0 ],
+)
+
+parser.add_argument(
+	"--frameParallelism",
+	help = "Whether frames are read serially, in parallel, or both.",
+	choices = [ "serial", "parallel", "both" ],
+	default = "parallel",
+)
+
+parser.add_argument(
+	"--flags",
+	help = "The things to read from each location.",
+	nargs = "+",
+	choices = [ "Bounds", "Transforms", "Attributes", "Tags", "Sets", "Objects", "All" ],
+	default = [ "All" ],
+)
+
+parser.add_argument(
+	"--repeats",
+	help = "The number of times to repeat each read. The scene is reopened\n"
+		"for each repeat, but process-wide caches such as the ObjectPool\n"
+		"persist, so only the first read is guaranteed to be cold.",
+	type = int,
+	default = 3,
+)
+
+parser.add_argument(
+	"--shareObjectData",
+	help = "Enables SceneCache's sharing of identical object data, reporting\n"
+		"the memory saved as sharedObjectBytes.",
+	action = "store_true",
+)
+
+parser.add_argument(
+	"--json",
+	help = "A file to write the results to.",
+)
+
+args = parser.parse_args()
+
+IECoreScene.SceneCache.setObjectDataSharingEnabled( args.shareObjectData )
+
+flags = 0
+for f in args.flags :
+	flags |= getattr( IECoreScene.SceneAlgo.ProcessFlags, f )
+
+parallelFrames = {
+	"serial" : [ False ],
+	"parallel" : [ True ],
+	"both" : [ False, True ],
+}[args.frameParallelism]
+
+stages = [ "bounds", "transforms", "attributes", "tags", "sets", "objects" ]
+
+def benchmark( fileName, threads, parallel ) :
+
+	runs = []
+	for i in range( 0, args.repeats ) :
+
+		scene = IECoreScene.SceneInterface.create( fileName, IECore.IndexedIO.OpenMode.Read )
+		sharedBytes = IECoreScene.SceneCache.objectDataMemorySaved()
+
+		if threads :
+			with IECore.tbb_task_scheduler_init( max_threads = threads ) :
+				stats = IECoreScene.SceneAlgo.parallelReadAll( scene, args.frames[0], args.frames[1], args.frameRate, flags, parallel )
+		else :
+			stats = IECoreScene.SceneAlgo.parallelReadAll( scene, args.frames[0], args.frames[1], args.frameRate, flags, parallel )
+
+		# Only SceneCache shares object data, so this is zero for other formats
+		# and when --shareObjectData isn't used.
+		stats["sharedObjectBytes"] = IECoreScene.SceneCache.objectDataMemorySaved() - sharedBytes
+		runs.append( stats )
+
+	best = min( runs, key = lambda s : s["time"] )
+	seconds = best["time"] / 1e9
+
+	return {
+		"file" : fileName,
+		"fileBytes" : os.path.getsize( fileName ) if os.path.isfile( fileName ) else 0,
+		"threads" : threads,
+		"parallelFrames" : parallel,
+		"seconds" : seconds,
+		"times" : [ r["time"] / 1e9 for r in runs ],
+		"locationsPerSecond" : best["locations"] / seconds if seconds else 0,
+		"bytesLoadedPerSecond" : ( best["objectBytes"] + best["attributeBytes"] ) / seconds if seconds else 0,
+		"stats" : best,
+	}
+
+def report( result ) :
+
+	stats = result["stats"]
+	print( "{file} : threads {threads}, {parallel} frames".format(
+		file = result["file"], threads = result["threads"] or "default",
+		parallel = "parallel" if result["parallelFrames"] else "serial"
+	) )
+	print( "    time           : {0:.3f}s (best of {1}, first {2:.3f}s)".format( result["seconds"], len( result["times"] ), result["times"][0] ) )
+	print( "    locations      : {0} ({1:.0f}/s)".format( stats["locations"], result["locationsPerSecond"] ) )
+	print( "    bytes loaded (in memory) : {0} ({1:.1f}MB/s)".format( stats["objectBytes"] + stats["attributeBytes"], result["bytesLoadedPerSecond"] / ( 1024 * 1024 ) ) )
+	print( "    bytes shared   : {0}".format( stats["sharedObjectBytes"] ) )
+	for stage in stages :
+		stageTime = stats[stage + "Time"]
+		if stageTime :
+			print( "    {0:<14} : {1:.3f}s".format( stage, stageTime / 1e9 ) )
+	sys.stdout.flush()
+
+results = []
+for fileName in args.files :
+	for threads in args.threads :
+		for parallel in parallelFrames :
+			result = benchmark( fileName, threads, parallel )
+			report( result )
+			results.append( result )
+
+if args.json :
+	with open( args.json, "w" ) as f :
+		json.dump( results, f, indent = 4, sort_keys = True )
@@ -39,6 +39,7 @@
 
 #include "boost/static_assert.hpp"
 
+#include <cstring>
 #include <stdint.h>
 
 namespace IECore
@@ -163,6 +164,57 @@ inline double reverseBytes<double>( const double &x )
 	return xx.d;
 }
 
+namespace Detail
+{
+
+template<size_t Size>
+struct UnsignedOfSize;
+
+template<>
+struct UnsignedOfSize<1>
+{
+	typedef unsigned char Type;
+};
+
+template<>
+struct UnsignedOfSize<2>
+{
+	typedef uint16_t Type;
+};
+
+template<>
+struct UnsignedOfSize<4>
+{
+	typedef uint32_t Type;
+};
+
+template<>
+struct UnsignedOfSize<8>
+{
+	typedef Imf::Int64 Type;
+};
+
+} // namespace Detail
+
+/// Copies n elements from src to dst, reversing the byte order
+/// of each. src and dst may be the same, but must not otherwise
+/// overlap. The elements are reinterpreted as unsigned integers of the
+/// same size, giving a loop which the compiler can vectorise, so this is
+/// considerably faster than calling reverseBytes() once per element. T
+/// must be a scalar type of 1, 2, 4 or 8 bytes.
+template<typename T>
+inline void reverseBytes( const T *src, T *dst, size_t n )
+{
+	typedef typename Detail::UnsignedOfSize<sizeof( T )>::Type U;
+	for( size_t i = 0; i < n; ++i )
+	{
+		U u;
+		memcpy( &u, src + i, sizeof( U ) );
+		u = reverseBytes<U>( u );
+		memcpy( dst + i, &u, sizeof( U ) );
+	}
+}
+
 /// If running on a big endian platform,
 /// returns a copy of x with reversed bytes,
 /// otherwise returns x unchanged.
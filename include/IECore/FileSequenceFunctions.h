@@ -55,6 +55,9 @@ IECORE_API void findSequences( const std::vector< std::string > &names, std::vec
 /// Generates all sequences with at least minSequenceSize elements residing in given directory in the form of a list of FileSequences.
 IECORE_API void ls( const std::string &path, std::vector< FileSequencePtr > &sequences, size_t minSequenceSize = 2 );
 
+/// As above, but listing several directories in parallel, returning the sequences for each.
+IECORE_API void ls( const std::vector< std::string > &paths, std::vector< std::vector< FileSequencePtr > > &sequences, size_t minSequenceSize = 2 );
+
 /// Attempts to find a sequence matching the given sequence template (e.g. with at least one '#' character).
 IECORE_API void ls( const std::string &sequencePath, FileSequencePtr &sequence, size_t minSequenceSize = 2 );
 
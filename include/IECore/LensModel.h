@@ -113,6 +113,14 @@ class IECORE_API LensModel : public Parameterised
 		/// Should be implemented by derived classes to return the undistorted UV coordinate.
 		//! @param uv The distorted point that will be undistorted. Should be a 2D vector in pixel space.
 		virtual Imath::V2d undistort( Imath::V2d p ) = 0;
+
+		/// Batch versions of distort() and undistort(), which transform `count` points
+		/// from `in` and store the results in `out`. The `in` and `out` arrays may be the
+		/// same. The default implementations simply call distort() or undistort() for each
+		/// point in turn. Derived classes may reimplement them to provide more efficient
+		/// implementations, for instance by transforming the points in parallel.
+		virtual void distortPoints( const Imath::V2d *in, Imath::V2d *out, size_t count );
+		virtual void undistortPoints( const Imath::V2d *in, Imath::V2d *out, size_t count );
 		//@}
 
 		//! @name Lens Model Registry
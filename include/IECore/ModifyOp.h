@@ -76,6 +76,15 @@ class IECORE_API ModifyOp : public Op
 		/// This won't be called if the Op is not enabled.
 		virtual void modify( Object *object, const CompoundObject *operands ) = 0;
 
+		/// May be reimplemented to return true by subclasses whose
+		/// modify() never edits the members of the object in place,
+		/// but instead replaces any member it needs to change. When
+		/// copyInput is on, such subclasses are passed a shallow copy
+		/// of the input, so that untouched members are shared with
+		/// the input rather than copied. The default implementation
+		/// returns false.
+		virtual bool replacesModifiedMembers() const;
+
 	private :
 
 		ParameterPtr m_inputParameter;
@@ -105,6 +105,14 @@ class IECORE_API Object : public RunTimeTyped
 		/// identical function is provided which returns a pointer
 		/// to the subclass rather than to this base class.
 		ObjectPtr copy() const;
+		/// Returns a shallow copy of this object. Member objects
+		/// held by the copy are shared with this object rather than
+		/// being copied themselves, making this much cheaper than
+		/// copy() for containers such as CompoundObject and
+		/// Primitive. Because the members are shared, they must be
+		/// replaced rather than modified in place if the original
+		/// is to be left unchanged.
+		ObjectPtr shallowCopy() const;
 		/// Copies from another object. Throws an IECore::InvalidArgumentException if
 		/// other is not an instance of this object.
 		void copyFrom( const Object *other );
@@ -197,13 +205,17 @@ class IECORE_API Object : public RunTimeTyped
 			public :
 				CopyContext();
 				~CopyContext();
-				/// Returns a copy of the specified object.
+				/// Returns a copy of the specified object. If the context
+				/// is being used to make a shallow copy, the object itself
+				/// is returned.
 				template<class T>
 				typename T::Ptr copy( const T *toCopy );
 			private :
+				friend class Object;
 				ObjectPtr copyInternal( const Object *toCopy );
 				struct CopiedObjects;
 				std::unique_ptr<CopiedObjects> m_copies;
+				bool m_shallow;
 		};
 
 		/// Must be implemented in all subclasses to make a deep copy of
@@ -264,18 +276,30 @@ class IECORE_API Object : public RunTimeTyped
 				template<class T>
 				/// Load an Object instance previously saved by SaveContext::save().
 				typename T::Ptr load( const IndexedIO *container, const IndexedIO::EntryID &name );
+				/// Loads several Object instances previously saved by SaveContext::save(),
+				/// returning them in the same order as `names`. When the container is
+				/// not open for writing, the objects are loaded in parallel.
+				template<class T>
+				std::vector<typename T::Ptr> load( const IndexedIO *container, const IndexedIO::EntryIDList &names );
 				/// Returns an interface to a raw container created by SaveContext::rawContainer() - please see
 				/// documentation and cautionary notes for that function.
 				const IndexedIO *rawContainer();
 
 			private :
 				struct LoadedObjects;
-				LoadContext( ConstIndexedIOPtr ioInterface, std::shared_ptr<LoadedObjects> loadedObjects );
+				LoadContext( ConstIndexedIOPtr ioInterface, std::shared_ptr<LoadedObjects> loadedObjects, const LoadContext *parent, const IndexedIO::EntryIDList &path );
 				ObjectPtr loadObjectOrReference( const IndexedIO *container, const IndexedIO::EntryID &name );
-				ObjectPtr loadObject( const IndexedIO *container );
+				void loadObjectsOrReferences( const IndexedIO *container, const IndexedIO::EntryIDList &names, std::vector<ObjectPtr> &objects );
+				ObjectPtr loadObject( const IndexedIO *container, const IndexedIO::EntryIDList &path );
+				bool loading( const IndexedIO::EntryIDList &path ) const;
 
 				ConstIndexedIOPtr m_ioInterface;
 				std::shared_ptr<LoadedObjects> m_loadedObjects;
+				// The context of the object being loaded when this one was
+				// created, and the path of the object this context is loading.
+				// Used to detect cyclic references.
+				boost::intrusive_ptr<const LoadContext> m_parent;
+				IndexedIO::EntryIDList m_path;
 		};
 		IE_CORE_DECLAREPTR( LoadContext );
 
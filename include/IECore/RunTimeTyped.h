@@ -262,7 +262,8 @@ class IECORE_API RunTimeTyped : public RefCounted
 		static bool inheritsFrom( TypeId typeId );
 		/// Returns true if this class inherits from the specified type.
 		static bool inheritsFrom( const char *typeName );
-		/// Returns true if type inherits from baseType.
+		/// Returns true if type inherits from baseType. This is lock free,
+		/// so may be called frequently from many threads without contention.
 		static bool inheritsFrom( TypeId type, TypeId baseType );
 		/// Returns true if typeName inherits from baseTypeName.
 		static bool inheritsFrom( const char *typeName, const char *baseTypeName );
@@ -275,6 +276,8 @@ class IECORE_API RunTimeTyped : public RefCounted
 		/// element will be the immediate base class, and the last elemenet will be RunTimeTyped.
 		/// Should not be called during static initialization as it's likely that not all types will
 		/// have been registered at that point, so to do so would yield an incomplete list.
+		/// The result is computed on the first call for each type, and subsequent calls are
+		/// lock free.
 		static const std::vector<TypeId> &baseTypeIds( TypeId typeId );
 
 		/// Returns all derived types of the given type, or an empty set if no such derived types exist.
@@ -304,20 +307,11 @@ class IECORE_API RunTimeTyped : public RefCounted
 		};
 
 		typedef std::map< TypeId, TypeId > BaseTypeRegistryMap;
-		typedef std::map< TypeId, std::vector<TypeId> > BaseTypesRegistryMap;
 		typedef std::map< TypeId, std::set< TypeId > > DerivedTypesRegistryMap;
 
-		typedef tbb::spin_rw_mutex Mutex;
-
-		static Mutex g_baseTypeIdsMutex;
-		static Mutex g_derivedTypeIdsMutex;
-
 		static BaseTypeRegistryMap &baseTypeRegistry();
 		static DerivedTypesRegistryMap &derivedTypesRegistry();
 
-		static BaseTypesRegistryMap &completeBaseTypesRegistry();
-		static DerivedTypesRegistryMap &completeDerivedTypesRegistry();
-
 		static void derivedTypeIdsWalk( TypeId typeId, std::set<TypeId> & );
 
 		typedef std::map<TypeId, std::string> TypeIdsToTypeNamesMap;
@@ -63,6 +63,10 @@ class IECORE_API StandardRadialLensModel : public LensModel
 		void validate() override;
 		Imath::V2d distort( Imath::V2d p ) override;
 		Imath::V2d undistort( Imath::V2d p ) override;
+		/// Transform the points in parallel. This is safe because the
+		/// model's state is not modified after validate() has been called.
+		void distortPoints( const Imath::V2d *in, Imath::V2d *out, size_t count ) override;
+		void undistortPoints( const Imath::V2d *in, Imath::V2d *out, size_t count ) override;
 
 	protected:
 
@@ -76,12 +80,17 @@ class IECORE_API StandardRadialLensModel : public LensModel
 		/// Transforms UV coordinates in the range 0-1
 		/// to dimesionless coordinates which
 		/// are used by the distortion algorithm.
-		Imath::V2d UVtoDN( const Imath::V2d& uv );
+		Imath::V2d UVtoDN( const Imath::V2d& uv ) const;
 
 		/// Transforms the dimesionless coordinates
 		/// used by the distortion algorithm to UV
 		/// coordinates of in the range 0-1.
-		Imath::V2d DNtoUV( const Imath::V2d& uv );
+		Imath::V2d DNtoUV( const Imath::V2d& uv ) const;
+
+		/// The implementations of distort() and undistort(), shared
+		/// with distortPoints() and undistortPoints().
+		Imath::V2d distortInternal( const Imath::V2d &p ) const;
+		Imath::V2d undistortInternal( const Imath::V2d &p ) const;
 
 		/// Coeficients needed by the distortion algorithm.
 		/// These values are calculated within validate().
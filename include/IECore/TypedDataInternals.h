@@ -36,6 +36,7 @@
 #define IECORE_TYPEDDATAINTERNALS_H
 
 #include "IECore/MurmurHash.h"
+#include "IECore/VectorDataAllocation.h"
 
 namespace IECore
 {
@@ -82,6 +83,25 @@ class IECORE_EXPORT SimpleDataHolder
 
 };
 
+namespace Detail
+{
+
+template<typename T>
+inline void copySharedData( T &dst, const T &src )
+{
+	dst = src;
+}
+
+// Vectors are copied in a way which allows the VectorDataAllocation
+// policy to be applied to the new storage.
+template<typename T>
+inline void copySharedData( std::vector<T> &dst, const std::vector<T> &src )
+{
+	VectorDataAllocation::assign( dst, src );
+}
+
+} // namespace Detail
+
 template<class T>
 class IECORE_EXPORT SharedDataHolder
 {
@@ -158,7 +178,10 @@ class IECORE_EXPORT SharedDataHolder
 			public :
 
 				Shareable() : data(), hashValid( false ) {}
-				Shareable( const T &initData ) : data( initData ), hashValid( false ) {}
+				Shareable( const T &initData ) : data(), hashValid( false )
+				{
+					Detail::copySharedData( data, initData );
+				}
 
 				T data;
 				MurmurHash hash;
@@ -0,0 +1,89 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2019, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//
+//     * Neither the name of Image Engine Design nor the names of any
+//       other contributors to this software may be used to endorse or
+//       promote products derived from this software without specific prior
+//       written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef IECORE_VECTORDATAALLOCATION_H
+#define IECORE_VECTORDATAALLOCATION_H
+
+#include "IECore/Export.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace IECore
+{
+
+/// Controls how the storage for large VectorTypedData buffers is
+/// prepared. Because TypedData exposes its storage as a plain
+/// `std::vector<T>`, the allocator itself can't be replaced without
+/// breaking the public API. Instead, buffers above a size threshold
+/// are reserved up front and advised for transparent huge pages
+/// before they are filled, so that the kernel can back them with 2M
+/// pages rather than 4K ones. This is applied whenever vector data
+/// is loaded from an IndexedIO, and whenever shared data is
+/// duplicated by a call to `writable()`.
+namespace VectorDataAllocation
+{
+
+/// Buffers of at least this many bytes are advised for huge pages.
+/// A value of 0 disables the advice. The default is taken from the
+/// IECORE_VECTORDATA_HUGEPAGE_THRESHOLD environment variable, specified
+/// in megabytes, and is 0 if it is not set or is not a valid number.
+IECORE_API void setHugePageThreshold( size_t bytes );
+IECORE_API size_t getHugePageThreshold();
+
+/// Advises the memory range `[data, data + bytes)` according to the
+/// current policy. Only whole pages within the range are affected.
+/// Returns true if the advice was applied.
+IECORE_API bool advise( void *data, size_t bytes );
+
+/// Returns the total number of bytes that have been advised for
+/// huge pages by this process, for use in benchmarks and diagnostics.
+IECORE_API size_t hugePageAdvisedBytes();
+
+/// Resizes `v` to hold `size` elements, applying the policy to the new
+/// storage before it is initialised.
+template<typename T>
+void resize( std::vector<T> &v, size_t size );
+/// Assigns `src` to `dst`, applying the policy to `dst`'s storage before
+/// the elements are copied.
+template<typename T>
+void assign( std::vector<T> &dst, const std::vector<T> &src );
+
+} // namespace VectorDataAllocation
+
+} // namespace IECore
+
+#include "IECore/VectorDataAllocation.inl"
+
+#endif // IECORE_VECTORDATAALLOCATION_H
@@ -0,0 +1,94 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2019, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//
+//     * Neither the name of Image Engine Design nor the names of any
+//       other contributors to this software may be used to endorse or
+//       promote products derived from this software without specific prior
+//       written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef IECORE_VECTORDATAALLOCATION_INL
+#define IECORE_VECTORDATAALLOCATION_INL
+
+namespace IECore
+{
+
+namespace VectorDataAllocation
+{
+
+namespace Detail
+{
+
+template<typename T>
+inline bool reserve( std::vector<T> &v, size_t size )
+{
+	const size_t threshold = getHugePageThreshold();
+	if( !threshold || size * sizeof( T ) < threshold || v.capacity() >= size )
+	{
+		return false;
+	}
+
+	// Reserving into an empty vector gives us a fresh allocation
+	// which hasn't been touched yet, so the advice takes effect
+	// before any pages are faulted in.
+	std::vector<T> fresh;
+	fresh.reserve( size );
+	advise( fresh.data(), size * sizeof( T ) );
+	fresh.insert( fresh.end(), v.begin(), v.end() );
+	v.swap( fresh );
+	return true;
+}
+
+// std::vector<bool> is bit-packed and doesn't expose its storage.
+inline bool reserve( std::vector<bool> &v, size_t size )
+{
+	return false;
+}
+
+} // namespace Detail
+
+template<typename T>
+void resize( std::vector<T> &v, size_t size )
+{
+	Detail::reserve( v, size );
+	v.resize( size );
+}
+
+template<typename T>
+void assign( std::vector<T> &dst, const std::vector<T> &src )
+{
+	dst.clear();
+	Detail::reserve( dst, src.size() );
+	dst.insert( dst.end(), src.begin(), src.end() );
+}
+
+} // namespace VectorDataAllocation
+
+} // namespace IECore
+
+#endif // IECORE_VECTORDATAALLOCATION_INL
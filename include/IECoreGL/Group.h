@@ -37,6 +37,7 @@
 
 #include "IECoreGL/Export.h"
 #include "IECoreGL/Renderable.h"
+#include "IECoreGL/TypedStateComponent.h"
 
 #include "IECore/Export.h"
 
@@ -46,6 +47,7 @@ IECORE_POP_DEFAULT_VISIBILITY
 
 #include "tbb/recursive_mutex.h"
 
+#include <atomic>
 #include <list>
 
 
@@ -81,6 +83,9 @@ class IECOREGL_API Group : public Renderable
 
 		// render method ( assumes there's no threads modifying the group ).
 		void render( State *currentState ) const override;
+		/// The bound is cached, and is only recomputed after a Group has
+		/// been modified. Renderables whose bounds change after they have
+		/// been added to a Group must call invalidateCaches().
 		Imath::Box3f bound() const override;
 
 		void addChild( RenderablePtr child );
@@ -93,13 +98,54 @@ class IECOREGL_API Group : public Renderable
 		/// \todo Can we remove this?
 		Mutex &mutex() const;
 
+		/// When true, render() skips any children whose bounds lie
+		/// entirely outside the viewing frustum defined by the current
+		/// GL modelview and projection matrices. Because the bounds of
+		/// child Groups are cached, whole offscreen subtrees can be
+		/// skipped at the cost of a single bound test.
+		typedef TypedStateComponent<bool, GroupFrustumCullingTypeId> FrustumCulling;
+
+		/// Counts of the primitives (all non-Group Renderables) rendered
+		/// and culled by all calls to render() since the last call to
+		/// resetStatistics(). So as not to slow down the default drawing
+		/// path, only Groups with FrustumCulling enabled are counted.
+		struct Statistics
+		{
+			size_t renderedPrimitives;
+			size_t culledPrimitives;
+			size_t culledGroups;
+		};
+
+		static Statistics statistics();
+		static void resetStatistics();
+
+		/// Returns a count which is incremented whenever any Group
+		/// is modified. This may be used to validate caches of data
+		/// derived from a hierarchy of Groups.
+		static uint64_t generation();
+		/// Increments generation(), so that all cached bounds are
+		/// recomputed. This must be called whenever the bound of a
+		/// Renderable which has already been added to a Group changes.
+		static void invalidateCaches();
+
 	private :
 
+		void updateCache() const;
+		size_t numPrimitives() const;
+
 		StatePtr m_state;
 		Imath::M44f m_transform;
 		ChildContainer m_children;
 		mutable Mutex m_mutex;
 
+		// The bound of our children, transformed by m_transform,
+		// and the total number of primitives below us. These are
+		// valid if m_cacheGeneration matches the global generation
+		// count, which is incremented whenever any Group is modified.
+		mutable Imath::Box3f m_bound;
+		mutable size_t m_numPrimitives;
+		mutable std::atomic<uint64_t> m_cacheGeneration;
+
 };
 
 IE_CORE_DECLAREPTR( Group );
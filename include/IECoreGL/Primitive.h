@@ -48,8 +48,11 @@
 
 IECORE_PUSH_DEFAULT_VISIBILITY
 #include "OpenEXR/ImathBox.h"
+#include "OpenEXR/ImathMatrix.h"
 IECORE_POP_DEFAULT_VISIBILITY
 
+#include <vector>
+
 namespace IECoreGL
 {
 
@@ -84,6 +87,13 @@ class IECOREGL_API Primitive : public Renderable
 		/// by using the shaderSetup() and renderInstances() methods - in fact those methods
 		/// are used to implement this one.
 		void render( State *currentState ) const override;
+		/// Renders the primitive once for each of the transforms, each concatenated
+		/// with the current GL matrix. The result is identical to calling render()
+		/// once per transform, but the state and shader setups are bound only once
+		/// for all the draw calls, making this much quicker for many copies of the
+		/// same primitive. Derived classes which override render() must also
+		/// override this method.
+		virtual void renderAt( State *currentState, const std::vector<Imath::M44f> &transforms ) const;
 
 		//! @name Lower level rendering methods
 		/// These methods are used to implement the higher level render() method - they
@@ -184,6 +194,9 @@ class IECOREGL_API Primitive : public Renderable
 
 		mutable Shader::SetupPtr m_boundSetup;
 		const Shader::Setup *boundSetup() const;
+		// Implements render() and renderAt(), rendering once per transform,
+		// or once at the current matrix if `transforms` is null.
+		void renderInternal( State *currentState, const std::vector<Imath::M44f> *transforms ) const;
 
 		typedef std::map<std::string, IECore::ConstDataPtr> AttributeMap;
 		AttributeMap m_vertexAttributes;
@@ -0,0 +1,93 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2019, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//
+//     * Neither the name of Image Engine Design nor the names of any
+//       other contributors to this software may be used to endorse or
+//       promote products derived from this software without specific prior
+//       written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef IECOREGL_PRIMITIVEINSTANCER_H
+#define IECOREGL_PRIMITIVEINSTANCER_H
+
+#include "IECoreGL/Export.h"
+#include "IECoreGL/Renderable.h"
+#include "IECoreGL/TypeIds.h"
+
+#include "IECore/Export.h"
+
+IECORE_PUSH_DEFAULT_VISIBILITY
+#include "OpenEXR/ImathBox.h"
+#include "OpenEXR/ImathMatrix.h"
+IECORE_POP_DEFAULT_VISIBILITY
+
+#include <vector>
+
+namespace IECoreGL
+{
+
+IE_CORE_FORWARDDECLARE( Primitive );
+
+/// Renders many copies of a single Primitive, each with its own transform,
+/// using Primitive::renderAt(). Because the state and shader setups are bound
+/// only once, this is much quicker than rendering the same Primitive via
+/// many separate Groups. The deferred Renderer uses this to instance identical
+/// primitives automatically.
+class IECOREGL_API PrimitiveInstancer : public Renderable
+{
+
+	public :
+
+		IE_CORE_DECLARERUNTIMETYPEDEXTENSION( IECoreGL::PrimitiveInstancer, PrimitiveInstancerTypeId, Renderable );
+
+		PrimitiveInstancer( ConstPrimitivePtr primitive );
+		~PrimitiveInstancer() override;
+
+		const Primitive *primitive() const;
+
+		/// Adds another copy of the primitive, with the specified transform.
+		void addInstance( const Imath::M44f &transform );
+		const std::vector<Imath::M44f> &transforms() const;
+
+		void render( State *currentState ) const override;
+		Imath::Box3f bound() const override;
+
+	private :
+
+		ConstPrimitivePtr m_primitive;
+		Imath::Box3f m_primitiveBound;
+		std::vector<Imath::M44f> m_transforms;
+		Imath::Box3f m_bound;
+
+};
+
+IE_CORE_DECLAREPTR( PrimitiveInstancer );
+
+} // namespace IECoreGL
+
+#endif // IECOREGL_PRIMITIVEINSTANCER_H
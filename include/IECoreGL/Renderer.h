@@ -357,6 +357,11 @@ class IECOREGL_API Renderer : public IECoreScene::Renderer
 		/// If a procedural is not visible then it will not be opened
 		/// to discover if it's contents might turn visibility back on.
 		///
+		/// \li <b>"gl:frustumCulling" BoolData false</b><br>
+		/// When true, objects lying entirely outside the viewing frustum
+		/// are skipped when rendering the scene produced in deferred mode.
+		/// Maps to the Group::FrustumCulling state component.
+		///
 		/// \par Instancing attributes :
 		////////////////////////////////////////////////////////////
 		///
@@ -448,11 +453,16 @@ class IECOREGL_API Renderer : public IECoreScene::Renderer
 		void patchMesh( const IECore::CubicBasisf &uBasis, const IECore::CubicBasisf &vBasis, int nu, bool uPeriodic, int nv, bool vPeriodic, const IECoreScene::PrimitiveVariableMap &primVars ) override;
 		/// Not implemented
 		void geometry( const std::string &type, const IECore::CompoundDataMap &topology, const IECoreScene::PrimitiveVariableMap &primVars ) override;
+		/// In deferred mode, the primitives are converted in parallel and added
+		/// to the scene in a single group.
+		void primitives( const std::vector<IECoreScene::ConstPrimitivePtr> &primitives, const std::vector<Imath::M44f> &transforms = std::vector<Imath::M44f>() ) override;
 		void procedural( IECoreScene::Renderer::ProceduralPtr proc ) override;
 
 		void instanceBegin( const std::string &name, const IECore::CompoundDataMap &parameters ) override;
 		void instanceEnd() override;
 		void instance( const std::string &name ) override;
+		/// In deferred mode, the instances are added to the scene in a single group.
+		void instances( const std::string &name, const std::vector<Imath::M44f> &transforms ) override;
 
 		/// \par Commands implemented
 		///
@@ -71,6 +71,10 @@ class IECOREGL_API Scene : public Renderable
 		/// using raw gl calls before calling Scene::select. In either case the region applies.
 		/// \todo Have an overload which takes a Box2i specifying a raster space region
 		/// instead.
+		///
+		/// In Selector::Bound mode nothing is rendered, and instead a bounding volume
+		/// hierarchy of the primitives in the scene is built and tested against the region.
+		/// The hierarchy is cached until the next modification to a Group.
 		size_t select( Selector::Mode mode, const Imath::Box2f &region, std::vector<HitRecord> &hits ) const;
 
 		/// Sets the camera used to view the scene. If unspecified then
@@ -92,6 +96,9 @@ class IECOREGL_API Scene : public Renderable
 		GroupPtr m_root;
 		CameraPtr m_camera;
 
+		IE_CORE_FORWARDDECLARE( BoundingVolumeHierarchy );
+		mutable BoundingVolumeHierarchyPtr m_boundingVolumeHierarchy;
+
 };
 
 IE_CORE_DECLAREPTR( Scene );
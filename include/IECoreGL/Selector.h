@@ -82,7 +82,15 @@ class IECOREGL_API Selector : boost::noncopyable
 			/// Note that this mode is currently only supported for GLSL
 			/// versions 330 and up - lesser versions will fall back to using
 			/// the GLSelect mode.
-			IDRender
+			IDRender,
+			/// Tests the bounds of primitives against the selection region
+			/// on the CPU, without rendering anything at all. This is much
+			/// quicker than the other modes for dense scenes, and can select
+			/// multiple overlapping objects, but is only as accurate as the
+			/// bounds, and the depth information is that of the bounds rather
+			/// than the geometry. This mode is only supported by Scene::select(),
+			/// and the Selector constructor throws if it is passed.
+			Bound
 		};
 
 		/// Starts an operation to select objects in the specified
@@ -74,6 +74,7 @@ class IECOREGL_API TextPrimitive : public Primitive
 		//@}
 
 		void render( State *currentState ) const override;
+		void renderAt( State *currentState, const std::vector<Imath::M44f> &transforms ) const override;
 		void renderInstances( size_t numInstances ) const override;
 
 	private :
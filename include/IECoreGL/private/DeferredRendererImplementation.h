@@ -40,6 +40,7 @@
 #include "tbb/enumerable_thread_specific.h"
 
 #include <stack>
+#include <unordered_map>
 #include <vector>
 
 namespace IECoreGL
@@ -48,6 +49,7 @@ namespace IECoreGL
 IE_CORE_FORWARDDECLARE( Scene );
 IE_CORE_FORWARDDECLARE( State );
 IE_CORE_FORWARDDECLARE( Group );
+IE_CORE_FORWARDDECLARE( PrimitiveInstancer );
 
 class DeferredRendererImplementation : public RendererImplementation
 {
@@ -81,10 +83,12 @@ class DeferredRendererImplementation : public RendererImplementation
 		IECore::Data *getUserAttribute( const IECore::InternedString &name ) override;
 
 		void addPrimitive( ConstPrimitivePtr primitive ) override;
+		void addPrimitives( const std::vector<ConstPrimitivePtr> &primitives, const std::vector<Imath::M44f> &transforms ) override;
 
 		void addProcedural( IECoreScene::Renderer::ProceduralPtr proc, IECoreScene::RendererPtr renderer ) override;
 
 		void addInstance( GroupPtr grp ) override;
+		void addInstances( GroupPtr grp, const std::vector<Imath::M44f> &transforms ) override;
 
 		ScenePtr scene();
 
@@ -106,6 +110,20 @@ class DeferredRendererImplementation : public RendererImplementation
 			StateStack stateStack;
 			// stack of groups being built
 			GroupStack groupStack;
+			// incremented whenever the current state changes
+			size_t stateEpoch = 0;
+			// the group created for each primitive added, used to instance
+			// identical primitives automatically. Later copies added with
+			// the same state epoch are collected into a PrimitiveInstancer
+			// in the group, relative to the world matrix of its parent.
+			struct InstancedPrimitive
+			{
+				size_t stateEpoch;
+				Group *group;
+				Imath::M44f parentWorldInverse;
+				PrimitiveInstancer *instancer;
+			};
+			std::unordered_map<const Primitive *, InstancedPrimitive> instancedPrimitives;
 		};
 		IE_CORE_DECLAREPTR( RenderContext );
 
@@ -125,6 +143,13 @@ class DeferredRendererImplementation : public RendererImplementation
 		// pop method for procedural's context
 		RenderContextPtr popContext();
 
+		// Returns a new group holding the current transform and state, to be
+		// shared by all the children added by addPrimitives() or addInstances(),
+		// or null if the current state isn't visible.
+		GroupPtr batchGroup();
+		// Adds the group returned by batchGroup() to the current parent.
+		void addBatchGroup( GroupPtr batch );
+
 		class ProceduralTask;
 		struct ScopedRenderContext;
 };
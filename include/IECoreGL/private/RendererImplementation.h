@@ -48,6 +48,8 @@ IECORE_PUSH_DEFAULT_VISIBILITY
 #include "OpenEXR/ImathMatrix.h"
 IECORE_POP_DEFAULT_VISIBILITY
 
+#include <vector>
+
 namespace IECoreGL
 {
 
@@ -103,10 +105,19 @@ class RendererImplementation : public IECore::RunTimeTyped
 		T *getUserAttribute( const IECore::InternedString &name );
 
 		virtual void addPrimitive( ConstPrimitivePtr primitive ) = 0;
+		/// Adds many primitives at once. If `transforms` is not empty, each
+		/// primitive is added with the corresponding transform concatenated
+		/// with the current one. The default implementation calls addPrimitive()
+		/// for each primitive in turn.
+		virtual void addPrimitives( const std::vector<ConstPrimitivePtr> &primitives, const std::vector<Imath::M44f> &transforms );
 
 		virtual void addProcedural( IECoreScene::Renderer::ProceduralPtr proc, IECoreScene::RendererPtr renderer ) = 0;
 
 		virtual void addInstance( IECoreGL::GroupPtr grp ) = 0;
+		/// Adds an instance once for each transform, concatenated with
+		/// the current one. The default implementation calls addInstance()
+		/// for each transform in turn.
+		virtual void addInstances( IECoreGL::GroupPtr grp, const std::vector<Imath::M44f> &transforms );
 };
 
 IE_CORE_DECLAREPTR( RendererImplementation );
@@ -51,6 +51,9 @@ IE_CORE_FORWARDDECLARE( ImagePrimitive );
 /// converted to FloatVectorData. If 'rawChannels' is On, then it will return an
 /// ImagePrimitive with channels that are the close as possible to the original data
 /// type stored on the file.
+///
+/// All the requested channels are fetched from the file in a single pass, and are
+/// then de-interleaved and colour converted in parallel.
 /// \ingroup ioGroup
 class IECOREIMAGE_API ImageReader : public IECore::Reader
 {
@@ -81,6 +84,13 @@ class IECOREIMAGE_API ImageReader : public IECore::Reader
 		/// If true, the values will not be linearized nor converted to float.
 		IECore::BoolParameter *rawChannelsParameter();
 		const IECore::BoolParameter *rawChannelsParameter() const;
+		/// The parameter specifying the region of pixels to load. If empty
+		/// (the default value) then the whole data window is loaded.
+		IECore::Box2iParameter *dataWindowParameter();
+		const IECore::Box2iParameter *dataWindowParameter() const;
+		/// The parameter specifying if the shared ImageCache is used.
+		IECore::BoolParameter *sharedCacheParameter();
+		const IECore::BoolParameter *sharedCacheParameter() const;
 		//@}
 
 		//! @name Image specific reading functions
@@ -101,6 +111,22 @@ class IECOREIMAGE_API ImageReader : public IECore::Reader
 		/// each element corresponds to a pixel. If that does not correspond
 		/// to the native file format, then it should return a FloatVectorData.
 		IECore::DataPtr readChannel( const std::string &name, bool raw = false );
+		/// Reads several channels at once, returning them in the same order
+		/// as the names. This is much quicker than calling readChannel()
+		/// for each name, because the file is only read once.
+		std::vector<IECore::DataPtr> readChannels( const std::vector<std::string> &names, bool raw = false );
+		//@}
+
+		//! @name Shared cache
+		/// ImageReaders using the sharedCacheParameter() share a single
+		/// process-wide OpenImageIO ImageCache, so that decoded tiles are
+		/// reused between readers. Note that the shared cache does not
+		/// notice when files are modified on disk.
+		///////////////////////////////////////////////////////////////
+		//@{
+		/// Sets the maximum memory used by the shared cache, in megabytes.
+		static void setSharedCacheMemoryLimit( size_t megabytes );
+		static size_t getSharedCacheMemoryLimit();
 		//@}
 
 	protected :
@@ -118,6 +144,8 @@ class IECOREIMAGE_API ImageReader : public IECore::Reader
 
 		IECore::StringVectorParameterPtr m_channelNamesParameter;
 		IECore::BoolParameterPtr m_rawChannelsParameter;
+		IECore::Box2iParameterPtr m_dataWindowParameter;
+		IECore::BoolParameterPtr m_sharedCacheParameter;
 
 		class Implementation;
 		std::unique_ptr<Implementation> m_implementation;
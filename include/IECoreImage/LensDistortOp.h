@@ -49,6 +49,8 @@ namespace IECoreImage
 
 /// Distorts an ImagePrimitive using a parametric lens model.
 /// This Op expects a CompoundObject which contains the lens model's parameters.
+/// The distorted position of each pixel is computed once per combination of lens
+/// parameters, mode and image windows, and is cached for reuse by subsequent operations.
 /// \ingroup imageProcessingGroup
 class IECOREIMAGE_API LensDistortOp : public WarpOp
 {
@@ -82,7 +84,7 @@ class IECOREIMAGE_API LensDistortOp : public WarpOp
 		IECore::ObjectParameterPtr m_lensParameter;
 		IECore::IntParameterPtr m_modeParameter;
 		Imath::Box2i m_distortedDataWindow;
-		IECore::FloatVectorDataPtr m_cachePtr;
+		IECore::ConstV2fVectorDataPtr m_distortionMap;
 };
 
 IE_CORE_DECLAREPTR( LensDistortOp );
@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2019, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//
+//     * Neither the name of Image Engine Design nor the names of any
+//       other contributors to this software may be used to endorse or
+//       promote products derived from this software without specific prior
+//       written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef IECOREIMAGE_SUMMEDAREATABLE_H
+#define IECOREIMAGE_SUMMEDAREATABLE_H
+
+#include "IECore/Export.h"
+
+IECORE_PUSH_DEFAULT_VISIBILITY
+#include "OpenEXR/ImathBox.h"
+#include "OpenEXR/ImathVec.h"
+IECORE_POP_DEFAULT_VISIBILITY
+
+#include <vector>
+
+namespace IECoreImage
+{
+
+/// A summed area table, allowing the sum of the values within any
+/// rectangular region of an image to be computed in constant time.
+/// Values are accumulated using the Accumulator type, which defaults
+/// to double so that precision is maintained for large images. The
+/// table is built in parallel, using a prefix sum over the rows
+/// followed by a prefix sum over the columns.
+/// \ingroup imageProcessingGroup
+template<typename Accumulator = double>
+class SummedAreaTable
+{
+
+	public :
+
+		typedef Accumulator ValueType;
+
+		/// Builds a table for an image of the specified size, with pixel
+		/// coordinates starting at 0. The functor is called as
+		/// `functor( x, y )` to return the value of each pixel, and
+		/// may be called concurrently.
+		template<typename Functor>
+		SummedAreaTable( const Imath::V2i &size, Functor &&functor );
+		/// Builds a table from row-major pixel values.
+		template<typename T>
+		SummedAreaTable( const Imath::V2i &size, const T *values );
+
+		const Imath::V2i &size() const;
+
+		/// Returns the sum of the values within the box, which is inclusive
+		/// of its min and max and must lie within the image.
+		Accumulator sum( const Imath::Box2i &box ) const;
+		/// Returns the sum of all values up to and including those at x, y.
+		Accumulator sum( int x, int y ) const;
+
+		/// The table itself, stored in row-major order.
+		const std::vector<Accumulator> &table() const;
+
+	private :
+
+		Imath::V2i m_size;
+		std::vector<Accumulator> m_table;
+
+};
+
+} // namespace IECoreImage
+
+#include "IECoreImage/SummedAreaTable.inl"
+
+#endif // IECOREIMAGE_SUMMEDAREATABLE_H
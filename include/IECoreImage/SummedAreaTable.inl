@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2019, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//
+//     * Neither the name of Image Engine Design nor the names of any
+//       other contributors to this software may be used to endorse or
+//       promote products derived from this software without specific prior
+//       written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef IECOREIMAGE_SUMMEDAREATABLE_INL
+#define IECOREIMAGE_SUMMEDAREATABLE_INL
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
+namespace IECoreImage
+{
+
+template<typename Accumulator>
+template<typename Functor>
+SummedAreaTable<Accumulator>::SummedAreaTable( const Imath::V2i &size, Functor &&functor )
+	:	m_size( size )
+{
+	if( size.x <= 0 || size.y <= 0 )
+	{
+		m_size = Imath::V2i( 0 );
+		return;
+	}
+
+	m_table.resize( (size_t)size.x * size.y );
+	Accumulator *table = m_table.data();
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	// Sum along each row independently.
+	tbb::parallel_for(
+		tbb::blocked_range<int>( 0, size.y ),
+		[&]( const tbb::blocked_range<int> &range )
+		{
+			for( int y = range.begin(); y != range.end(); ++y )
+			{
+				Accumulator *row = table + (size_t)y * size.x;
+				Accumulator rowSum( 0 );
+				for( int x = 0; x < size.x; ++x )
+				{
+					rowSum += Accumulator( functor( x, y ) );
+					row[x] = rowSum;
+				}
+			}
+		},
+		taskGroupContext
+	);
+
+	// Then sum down each column, processing blocks of
+	// adjacent columns together to stay cache friendly.
+	tbb::parallel_for(
+		tbb::blocked_range<int>( 0, size.x, 256 ),
+		[&]( const tbb::blocked_range<int> &range )
+		{
+			for( int y = 1; y < size.y; ++y )
+			{
+				const Accumulator *above = table + (size_t)( y - 1 ) * size.x;
+				Accumulator *row = table + (size_t)y * size.x;
+				for( int x = range.begin(); x != range.end(); ++x )
+				{
+					row[x] += above[x];
+				}
+			}
+		},
+		taskGroupContext
+	);
+}
+
+template<typename Accumulator>
+template<typename T>
+SummedAreaTable<Accumulator>::SummedAreaTable( const Imath::V2i &size, const T *values )
+	:	SummedAreaTable( size, [values, &size]( int x, int y ) { return values[(size_t)y * size.x + x]; } )
+{
+}
+
+template<typename Accumulator>
+const Imath::V2i &SummedAreaTable<Accumulator>::size() const
+{
+	return m_size;
+}
+
+template<typename Accumulator>
+inline Accumulator SummedAreaTable<Accumulator>::sum( int x, int y ) const
+{
+	if( x < 0 || y < 0 )
+	{
+		return Accumulator( 0 );
+	}
+	return m_table[(size_t)y * m_size.x + x];
+}
+
+template<typename Accumulator>
+inline Accumulator SummedAreaTable<Accumulator>::sum( const Imath::Box2i &box ) const
+{
+	// The box is inclusive, so we need to step outside it.
+	return
+		sum( box.max.x, box.max.y ) -
+		sum( box.max.x, box.min.y - 1 ) -
+		sum( box.min.x - 1, box.max.y ) +
+		sum( box.min.x - 1, box.min.y - 1 );
+}
+
+template<typename Accumulator>
+const std::vector<Accumulator> &SummedAreaTable<Accumulator>::table() const
+{
+	return m_table;
+}
+
+} // namespace IECoreImage
+
+#endif // IECOREIMAGE_SUMMEDAREATABLE_INL
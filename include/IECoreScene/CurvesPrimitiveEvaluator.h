@@ -149,6 +149,22 @@ class IECORESCENE_API CurvesPrimitiveEvaluator : public PrimitiveEvaluator
 		float curveLength( unsigned curveIndex, float vStart=0.0f, float vEnd=1.0f ) const;
 		//@}
 
+		//! @name Batch query functions
+		/// These perform many queries in a single call, distributing the work
+		/// across threads. They are considerably faster than making the
+		/// equivalent queries one at a time via a Result.
+		////////////////////////////////////////////////////////////////////////////////////////
+		//@{
+		/// Evaluates the position, and optionally the v tangent, for each
+		/// ( curveIndices[i], v[i] ) pair. Throws an InvalidArgumentException if
+		/// the inputs differ in length or if any query is out of range.
+		void pointsAtV( const std::vector<int> &curveIndices, const std::vector<float> &v, std::vector<Imath::V3f> &points, std::vector<Imath::V3f> *vTangents = nullptr ) const;
+		/// Finds the closest point on the curves to each point in p, returning
+		/// the curve index and v parameter of each. Returns false if there are
+		/// no curves.
+		bool closestPoints( const std::vector<Imath::V3f> &p, std::vector<int> &curveIndices, std::vector<float> &v ) const;
+		//@}
+
 		//! @name Topology access
 		/// These functions make it easier to index curve data manually in cases where the
 		/// queries above are not sufficient.
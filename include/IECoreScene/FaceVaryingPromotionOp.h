@@ -74,6 +74,8 @@ class IECORESCENE_API FaceVaryingPromotionOp : public MeshPrimitiveOp
 	protected :
 
 		void modifyTypedPrimitive( MeshPrimitive *mesh, const IECore::CompoundObject *operands ) override;
+		/// Returns true - modified primitive variables are always replaced.
+		bool replacesModifiedMembers() const override;
 
 	private :
 
@@ -46,6 +46,8 @@ IECORE_PUSH_DEFAULT_VISIBILITY
 #include "OpenEXR/ImathVec.h"
 IECORE_POP_DEFAULT_VISIBILITY
 
+#include <vector>
+
 namespace IECoreScene
 {
 
@@ -53,7 +55,9 @@ IE_CORE_FORWARDDECLARE( MeshPrimitive );
 IE_CORE_FORWARDDECLARE( Group );
 
 /// The Font class allows the loading of fonts and their
-/// conversion to MeshPrimitives.
+/// conversion to MeshPrimitives. The const methods may be
+/// called concurrently from multiple threads, and glyphs are
+/// meshed in parallel where possible.
 /// \ingroup renderingGroup
 class IECORESCENE_API Font : public IECore::RunTimeTyped
 {
@@ -86,8 +90,16 @@ class IECORESCENE_API Font : public IECore::RunTimeTyped
 		/// is const.
 		const MeshPrimitive *mesh( char c ) const;
 		/// Returns a mesh representing the specified string,
-		/// using the current curve tolerance and kerning.
+		/// using the current curve tolerance and kerning. Strings
+		/// are interpreted as UTF-8, with any bytes that aren't
+		/// valid UTF-8 being treated as Latin-1.
 		MeshPrimitivePtr mesh( const std::string &text ) const;
+		/// Returns a single mesh representing all the specified
+		/// strings, each laid out starting at the corresponding
+		/// origin. This is much quicker than meshing and merging
+		/// the strings individually, as glyphs are meshed in
+		/// parallel and the result is built in a single pass.
+		MeshPrimitivePtr mesh( const std::vector<std::string> &texts, const std::vector<Imath::V2f> &origins ) const;
 		/// Returns a group representing the specified string,
 		/// using the current curve tolerance and kerning.
 		GroupPtr meshGroup( const std::string &text ) const;
@@ -66,6 +66,8 @@ class IECORESCENE_API MeshNormalsOp : public MeshPrimitiveOp
 	protected:
 
 		void modifyTypedPrimitive( MeshPrimitive * mesh, const IECore::CompoundObject * operands ) override;
+		/// Returns true - modified primitive variables are always replaced.
+		bool replacesModifiedMembers() const override;
 
 	private :
 
@@ -40,6 +40,8 @@
 
 #include "IECore/VectorTypedData.h"
 
+#include <memory>
+
 namespace IECoreScene
 {
 
@@ -47,6 +49,8 @@ namespace IECoreScene
 /// interface for Maya .pdc format particle caches. Percentage filtering
 /// of loaded particles is seeded using the particleId attribute, so
 /// is not only repeatable but also consistent from frame to frame.
+/// The file is memory mapped rather than streamed, so only the
+/// attributes which are actually requested are ever paged in from disk.
 /// \ingroup ioGroup
 class IECORESCENE_API PDCParticleReader : public ParticleReader
 {
@@ -87,13 +91,15 @@ class IECORESCENE_API PDCParticleReader : public ParticleReader
 		struct Record
 		{
 			int type;
-			std::streampos position;
+			// Offset of the attribute data from the start of the file.
+			size_t offset;
 		};
 
-		// makes sure that m_iStream is open and that m_header is full.
+		// makes sure that m_file is open and that m_header is full.
 		// returns true on success and false on failure.
 		bool open();
-		std::ifstream *m_iStream;
+		struct MappedFile;
+		std::unique_ptr<MappedFile> m_file;
 		std::string m_streamFileName;
 		struct
 		{
@@ -105,7 +111,12 @@ class IECORESCENE_API PDCParticleReader : public ParticleReader
 		} m_header;
 
 		template<typename T>
-		void readElements( T *buffer, std::streampos pos, unsigned long n ) const;
+		void readElements( T *buffer, size_t offset, unsigned long n ) const;
+		// As above, but converting from the type F stored in the file to
+		// type T as we go. This avoids reading the whole attribute into an
+		// intermediate buffer when no filtering is required.
+		template<typename T, typename F>
+		void readConvertedElements( T *buffer, size_t offset, unsigned long n ) const;
 
 		// loads particleId in a completely unfiltered state
 		const IECore::Data * idAttribute();
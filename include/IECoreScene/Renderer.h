@@ -52,11 +52,13 @@ IECORE_PUSH_DEFAULT_VISIBILITY
 IECORE_POP_DEFAULT_VISIBILITY
 
 #include <set>
+#include <vector>
 
 namespace IECoreScene
 {
 
 IE_CORE_FORWARDDECLARE( Renderer );
+IE_CORE_FORWARDDECLARE( Primitive );
 
 /// The Renderer class provides a means of describing scenes for rendering. Its
 /// interface is modelled closely on OpenGL/Renderman with an attribute and
@@ -299,6 +301,13 @@ class IECORESCENE_API Renderer : public IECore::RunTimeTyped
 		virtual void patchMesh( const IECore::CubicBasisf &uBasis, const IECore::CubicBasisf &vBasis, int nu, bool uPeriodic, int nv, bool vPeriodic, const PrimitiveVariableMap &primVars ) = 0;
 		/// Generic call for specifying renderer specify geometry types.
 		virtual void geometry( const std::string &type, const IECore::CompoundDataMap &topology, const PrimitiveVariableMap &primVars ) = 0;
+		/// Renders many primitives in a single call, avoiding the overhead of emitting
+		/// them one at a time, which can dominate for scenes containing many small
+		/// primitives. If `transforms` is not empty it must be the same length as
+		/// `primitives`, and each primitive is rendered with the corresponding transform
+		/// concatenated with the current one. The default implementation calls
+		/// Primitive::render() for each primitive in turn.
+		virtual void primitives( const std::vector<ConstPrimitivePtr> &primitives, const std::vector<Imath::M44f> &transforms = std::vector<Imath::M44f>() );
 		//@}
 
 		/// The Procedural class defines an interface via which the Renderer can
@@ -381,6 +390,10 @@ class IECORESCENE_API Renderer : public IECore::RunTimeTyped
 		/// Instantiates a previously described instance at the current transform position, and
 		/// using the current attribute state.
 		virtual void instance( const std::string &name ) = 0;
+		/// Instantiates a previously described instance once for each transform, with
+		/// each transform concatenated with the current one. The default implementation
+		/// calls instance() for each transform in turn.
+		virtual void instances( const std::string &name, const std::vector<Imath::M44f> &transforms );
 		//@}
 
 		/// Generic call for executing arbitrary renderer commands. This is intended to allow
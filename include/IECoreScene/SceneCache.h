@@ -35,7 +35,9 @@
 #ifndef IECORESCENE_SCENECACHE_H
 #define IECORESCENE_SCENECACHE_H
 
+#include "IECore/ObjectPool.h"
 #include "IECore/PathMatcherData.h"
+#include "IECore/VectorTypedData.h"
 
 #include "IECoreScene/Export.h"
 #include "IECoreScene/SampledSceneInterface.h"
@@ -136,9 +138,56 @@ class IECORESCENE_API SceneCache : public SampledSceneInterface
 
 		void hash( HashType hashType, double time, IECore::MurmurHash &h ) const override;
 
+		/// Batch queries for reading many times at once, returning one result
+		/// per time. The results are identical to calling readBound(),
+		/// readTransformAsMatrix() or readObjectPrimitiveVariables() once per
+		/// time, but each underlying sample is read only once, and the reads
+		/// are performed in parallel. This makes a big difference for motion
+		/// blur and bound-over-frame-range queries.
+		IECore::Box3dVectorDataPtr readBounds( const std::vector<double> &times ) const;
+		IECore::M44dVectorDataPtr readTransformsAsMatrices( const std::vector<double> &times ) const;
+		std::vector<PrimitiveVariableMap> readObjectPrimitiveVariablesAtTimes( const std::vector<IECore::InternedString> &primVarNames, const std::vector<double> &times ) const;
+
 		/// tells you if this scene cache is read only or writable:
 		bool readOnly() const;
 
+		/// Determines how the primitive variables of Primitive objects
+		/// are laid out in the file.
+		enum ObjectLayout
+		{
+			/// Each object sample is saved as a whole, using Object::save().
+			SampleLayout,
+			/// Unindexed vector primitive variables are stored separately from
+			/// the object samples, with the data for consecutive samples stored
+			/// contiguously in blocks. This makes it much quicker to read a
+			/// primitive variable over a range of frames, at the expense of
+			/// reading slightly more data for isolated samples. Files written
+			/// with this layout can't be read by versions of Cortex predating it.
+			ColumnLayout
+		};
+
+		/// Sets the layout used for all objects subsequently written to the
+		/// file. May be called on any location of a writable scene.
+		void setObjectLayout( ObjectLayout layout );
+		/// For writable scenes, returns the layout set for the file. For
+		/// read only scenes, returns the layout of the object at this
+		/// location, or SampleLayout if there is no object.
+		ObjectLayout getObjectLayout() const;
+
+		/// When enabled, the topology and any primitive variables known not to
+		/// be animated are shared between objects with identical data, even if
+		/// they were read from different samples, locations or files. This saves
+		/// memory when many objects share topology, but requires all such data
+		/// to be hashed as it is loaded, so is disabled by default.
+		static void setObjectDataSharingEnabled( bool enabled );
+		static bool getObjectDataSharingEnabled();
+		/// Returns the pool used to find identical data when sharing is
+		/// enabled. This is separate from ObjectPool::defaultObjectPool(),
+		/// so that sharing doesn't evict other clients' objects.
+		static IECore::ObjectPool *objectDataPool();
+		/// Returns the total number of bytes saved by sharing so far.
+		static size_t objectDataMemorySaved();
+
 		// The attribute names used to mark animated topology and primitive variables
 		// when SceneCache objects are Primitives.
 		static const Name &animatedObjectTopologyAttribute;
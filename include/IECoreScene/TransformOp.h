@@ -67,6 +67,8 @@ class IECORESCENE_API TransformOp : public PrimitiveOp
 	protected :
 
 		void modifyPrimitive( Primitive * primitive, const IECore::CompoundObject * operands ) override;
+		/// Returns true - modified primitive variables are always replaced.
+		bool replacesModifiedMembers() const override;
 
 	private :
 
@@ -46,12 +46,24 @@
 #include "boost/filesystem/operations.hpp"
 #include "boost/filesystem/path.hpp"
 #include "boost/format.hpp"
-#include "boost/lexical_cast.hpp"
+#include "boost/functional/hash.hpp"
 #include "boost/regex.hpp"
 #include "boost/version.hpp"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
 #include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+#ifndef _WIN32
+#include <dirent.h>
+#endif
 
 #include <math.h>
 
@@ -83,105 +95,391 @@
 
 using namespace IECore;
 
-void IECore::findSequences( const std::vector< std::string > &names, std::vector< FileSequencePtr > &sequences, size_t minSequenceSize )
+//////////////////////////////////////////////////////////////////////////
+// Internal implementation
+//////////////////////////////////////////////////////////////////////////
+
+namespace
 {
-	sequences.clear();
 
-	/// this matches names of the form $prefix$frameNumber$suffix
-	/// placing each of those in a group of the resulting match.
-	/// both $prefix and $suffix may be the empty string and $frameNumber
-	/// may be preceded by a minus sign.
-	/// It also matches file extensions with 3 or 4 characters that contain numbers (for example: CR2, MP3 )
-	boost::regex matchExpression( std::string( "^([^#]*?)(-?[0-9]+)([^0-9#]*|[^0-9#]*\\.[a-zA-Z]{2,3}[0-9])$" ) );
+inline bool isDigit( char c )
+{
+	return c >= '0' && c <= '9';
+}
+
+inline bool isAlpha( char c )
+{
+	return ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' );
+}
+
+// Equivalent to std::string::compare(), without requiring strings.
+inline int compare( const char *a, size_t aSize, const char *b, size_t bSize )
+{
+	const int c = memcmp( a, b, std::min( aSize, bSize ) );
+	if( c )
+	{
+		return c;
+	}
+	return aSize < bSize ? -1 : ( aSize > bSize ? 1 : 0 );
+}
+
+// Splits names of the form $prefix$frameNumber$suffix, returning false
+// if the name doesn't have that form. Both $prefix and $suffix may be
+// the empty string and $frameNumber may be preceded by a minus sign.
+// File extensions with 2 or 3 letters followed by a digit (for example
+// CR2 or MP3) are treated as part of the suffix. This is equivalent to
+// matching against the regex
+//
+// ^([^#]*?)(-?[0-9]+)([^0-9#]*|[^0-9#]*\.[a-zA-Z]{2,3}[0-9])$
+//
+// but is many times quicker, which matters when listing directories
+// containing hundreds of thousands of frames.
+bool splitName( const char *name, size_t size, size_t &frameBegin, size_t &frameEnd )
+{
+	if( memchr( name, '#', size ) )
+	{
+		return false;
+	}
 
-	/// build a mapping from ($prefix, $suffix) to a list of $frameNumbers
-	typedef std::vector< std::string > Frames;
-	typedef std::map< std::pair< std::string, std::string >, Frames > SequenceMap;
+	// Find the last run of digits.
+	size_t i = size;
+	while( i && !isDigit( name[i-1] ) )
+	{
+		--i;
+	}
+	if( !i )
+	{
+		return false;
+	}
 
-	SequenceMap sequenceMap;
+	frameEnd = i;
+	while( i && isDigit( name[i-1] ) )
+	{
+		--i;
+	}
+	frameBegin = i;
 
-	for ( std::vector< std::string >::const_iterator it = names.begin(); it != names.end(); ++it )
+	// If the name ends in a numbered extension, then the frame number
+	// is the previous run of digits, if there is one.
+	if( frameEnd == size && frameEnd - frameBegin == 1 )
 	{
-		boost::smatch matches;
-		if ( boost::regex_match( *it, matches, matchExpression ) )
+		size_t letters = 0;
+		while( letters < 4 && frameBegin > letters && isAlpha( name[frameBegin-letters-1] ) )
+		{
+			++letters;
+		}
+		if( ( letters == 2 || letters == 3 ) && frameBegin > letters && name[frameBegin-letters-1] == '.' )
 		{
-			sequenceMap[
-				SequenceMap::key_type(
-					std::string( matches[1].first, matches[1].second ),
-					std::string( matches[3].first, matches[3].second )
-				)
-			].push_back( std::string( matches[2].first, matches[2].second ) );
+			i = frameBegin - letters - 1;
+			while( i && !isDigit( name[i-1] ) )
+			{
+				--i;
+			}
+			if( i )
+			{
+				frameEnd = i;
+				while( i && isDigit( name[i-1] ) )
+				{
+					--i;
+				}
+				frameBegin = i;
+			}
 		}
 	}
 
-	for ( SequenceMap::const_iterator it = sequenceMap.begin(); it != sequenceMap.end(); ++it )
+	if( frameBegin && name[frameBegin-1] == '-' )
+	{
+		--frameBegin;
+	}
+
+	return true;
+}
+
+// Parses the digits of a frame number, returning false if it
+// is too large to be represented by a FrameList::Frame.
+bool parseFrame( const char *digits, size_t size, FrameList::Frame &frame )
+{
+	const FrameList::Frame maxFrame = std::numeric_limits<FrameList::Frame>::max();
+	frame = 0;
+	for( const char *c = digits, *e = digits + size; c != e; ++c )
 	{
-		const SequenceMap::key_type &fixes = it->first;
-		const Frames &frames = it->second;
-		// todo: could be more efficient by writing a custom comparison function that uses indexes
-		//	 into the const Frames vector rather than duplicating the strings and sorting them directly
-		Frames sortedFrames = frames;
-		std::sort( sortedFrames.begin(), sortedFrames.end() );
-
-		/// in diabolical cases the elements of frames may not all have the same padding
-		/// so we'll sort them out into padded and unpadded frame sequences here, by creating
-		/// a map of padding->list of frames. unpadded things will be considered to have a padding
-		/// of 1.
-		typedef std::vector< FrameList::Frame > NumericFrames;
-		typedef std::map< unsigned int, NumericFrames > PaddingToFramesMap;
-		PaddingToFramesMap paddingToFrames;
-		for ( Frames::const_iterator fIt = sortedFrames.begin(); fIt != sortedFrames.end(); ++fIt )
+		const int d = *c - '0';
+		if( frame > ( maxFrame - d ) / 10 )
+		{
+			return false;
+		}
+		frame = frame * 10 + d;
+	}
+	return true;
+}
+
+// Owns the names returned by readdir(), which are only valid until the
+// next call. Names are packed into large blocks to avoid making an
+// allocation per file.
+class NameStorage
+{
+
+	public :
+
+		NameStorage()
+			:	m_blockUsed( 0 ), m_blockSize( 0 )
 		{
-			std::string frame = *fIt;
-			int sign = 1;
+		}
+
+		const char *add( const char *name, size_t size )
+		{
+			if( m_blockUsed + size > m_blockSize )
+			{
+				m_blockSize = std::max( size, (size_t)65536 );
+				m_blocks.emplace_back( new char[m_blockSize] );
+				m_blockUsed = 0;
+			}
+
+			char *result = m_blocks.back().get() + m_blockUsed;
+			memcpy( result, name, size );
+			m_blockUsed += size;
+			return result;
+		}
+
+	private :
+
+		std::vector<std::unique_ptr<char[]>> m_blocks;
+		size_t m_blockUsed;
+		size_t m_blockSize;
 
-			assert( frame.size() );
-			if ( *frame.begin() == '-' )
+};
+
+// Groups names into FileSequences. Names are referenced rather than
+// copied, so must remain valid for the lifetime of the builder.
+class SequenceBuilder
+{
+
+	public :
+
+		void add( const char *name, size_t size )
+		{
+			size_t frameBegin, frameEnd;
+			if( !splitName( name, size, frameBegin, frameEnd ) )
 			{
-				frame = frame.substr( 1, frame.size() - 1 );
-				sign = -1;
+				return;
 			}
-			if ( *frame.begin() == '0' || paddingToFrames.find( frame.size() ) != paddingToFrames.end() )
+
+			Frame frame;
+			frame.token = name + frameBegin;
+			frame.tokenSize = frameEnd - frameBegin;
+			const bool negative = *frame.token == '-';
+			if( !parseFrame( frame.token + negative, frame.tokenSize - negative, frame.value ) )
 			{
-				paddingToFrames[ frame.size() ].push_back( sign * boost::lexical_cast<FrameList::Frame>( frame ) );
+				return;
 			}
-			else
+			if( negative )
 			{
-				paddingToFrames[ 1 ].push_back( sign * boost::lexical_cast<FrameList::Frame>( frame ) );
+				frame.value = -frame.value;
 			}
+
+			const Fixes fixes = { name, frameBegin, name + frameEnd, size - frameEnd };
+			m_sequences[fixes].push_back( frame );
 		}
 
-		for ( PaddingToFramesMap::iterator pIt = paddingToFrames.begin(); pIt != paddingToFrames.end(); ++pIt )
+		void sequences( std::vector<FileSequencePtr> &sequences, size_t minSequenceSize ) const
 		{
-			const PaddingToFramesMap::key_type &padding = pIt->first;
-			NumericFrames &numericFrames = pIt->second;
-			std::sort( numericFrames.begin(), numericFrames.end() );
+			sequences.clear();
 
-			FrameListPtr frameList = frameListFromList( numericFrames );
-
-			std::vector< FrameList::Frame > expandedFrameList;
-			frameList->asList( expandedFrameList );
+			// Output in order of prefix and suffix, so that the
+			// result doesn't depend on the order of the names.
+			std::vector<const SequenceMap::value_type *> sortedSequences;
+			sortedSequences.reserve( m_sequences.size() );
+			for( const auto &s : m_sequences )
+			{
+				sortedSequences.push_back( &s );
+			}
+			std::sort(
+				sortedSequences.begin(), sortedSequences.end(),
+				[]( const SequenceMap::value_type *a, const SequenceMap::value_type *b ) {
+					const int c = compare( a->first.prefix, a->first.prefixSize, b->first.prefix, b->first.prefixSize );
+					if( c )
+					{
+						return c < 0;
+					}
+					return compare( a->first.suffix, a->first.suffixSize, b->first.suffix, b->first.suffixSize ) < 0;
+				}
+			);
 
-			/// remove any sequences with less than the given minimum.
-			if ( expandedFrameList.size() >= minSequenceSize )
+			std::vector<const Frame *> sortedFrames;
+			for( const auto *s : sortedSequences )
 			{
-				std::string frameTemplate;
-				for ( PaddingToFramesMap::key_type i = 0; i < padding; i++ )
+				const Fixes &fixes = s->first;
+				const std::vector<Frame> &frames = s->second;
+
+				sortedFrames.clear();
+				for( const auto &f : frames )
 				{
-					frameTemplate += "#";
+					sortedFrames.push_back( &f );
 				}
-
-				sequences.push_back(
-					new FileSequence(
-						fixes.first + frameTemplate + fixes.second,
-						frameList
-					)
+				std::sort(
+					sortedFrames.begin(), sortedFrames.end(),
+					[]( const Frame *a, const Frame *b ) {
+						return compare( a->token, a->tokenSize, b->token, b->tokenSize ) < 0;
+					}
 				);
+
+				/// in diabolical cases the elements of frames may not all have the same padding
+				/// so we'll sort them out into padded and unpadded frame sequences here, by creating
+				/// a map of padding->list of frames. unpadded things will be considered to have a padding
+				/// of 1.
+				typedef std::vector< FrameList::Frame > NumericFrames;
+				typedef std::map< unsigned int, NumericFrames > PaddingToFramesMap;
+				PaddingToFramesMap paddingToFrames;
+				for( const Frame *f : sortedFrames )
+				{
+					const char *digits = f->token;
+					size_t numDigits = f->tokenSize;
+					if( *digits == '-' )
+					{
+						++digits;
+						--numDigits;
+					}
+					if( *digits == '0' || paddingToFrames.find( numDigits ) != paddingToFrames.end() )
+					{
+						paddingToFrames[numDigits].push_back( f->value );
+					}
+					else
+					{
+						paddingToFrames[1].push_back( f->value );
+					}
+				}
+
+				for( auto &p : paddingToFrames )
+				{
+					NumericFrames &numericFrames = p.second;
+					std::sort( numericFrames.begin(), numericFrames.end() );
+
+					FrameListPtr frameList = frameListFromList( numericFrames );
+
+					std::vector< FrameList::Frame > expandedFrameList;
+					frameList->asList( expandedFrameList );
+
+					/// remove any sequences with less than the given minimum.
+					if( expandedFrameList.size() >= minSequenceSize )
+					{
+						std::string fileName( fixes.prefix, fixes.prefixSize );
+						fileName.append( p.first, '#' );
+						fileName.append( fixes.suffix, fixes.suffixSize );
+						sequences.push_back( new FileSequence( fileName, frameList ) );
+					}
+				}
 			}
 		}
+
+	private :
+
+		struct Fixes
+		{
+			const char *prefix;
+			size_t prefixSize;
+			const char *suffix;
+			size_t suffixSize;
+
+			bool operator == ( const Fixes &other ) const
+			{
+				return
+					prefixSize == other.prefixSize && suffixSize == other.suffixSize &&
+					!memcmp( prefix, other.prefix, prefixSize ) &&
+					!memcmp( suffix, other.suffix, suffixSize )
+				;
+			}
+		};
+
+		struct FixesHash
+		{
+			size_t operator()( const Fixes &fixes ) const
+			{
+				size_t result = boost::hash_range( fixes.prefix, fixes.prefix + fixes.prefixSize );
+				boost::hash_combine( result, boost::hash_range( fixes.suffix, fixes.suffix + fixes.suffixSize ) );
+				return result;
+			}
+		};
+
+		struct Frame
+		{
+			// The frame number as it appears in the name,
+			// including any minus sign and padding.
+			const char *token;
+			size_t tokenSize;
+			FrameList::Frame value;
+		};
+
+		typedef std::unordered_map<Fixes, std::vector<Frame>, FixesHash> SequenceMap;
+		SequenceMap m_sequences;
+
+};
+
+#ifdef _WIN32
+
+template<typename F>
+void listDirectory( const std::string &path, F &&f )
+{
+	boost::filesystem::directory_iterator end;
+	for( boost::filesystem::directory_iterator it( path ); it != end; ++it )
+	{
+		const std::string name = it->path().PATH_TO_STRING;
+		f( name.c_str(), name.size() );
 	}
 }
 
+#else
+
+struct DirCloser
+{
+	void operator()( DIR *dir ) const
+	{
+		closedir( dir );
+	}
+};
+
+// Calls `f( name, size )` for each entry in the directory, other than
+// "." and "..". We use readdir() directly because the allocations made by
+// boost::filesystem::directory_iterator for every entry dominate the cost
+// of listing very large directories.
+template<typename F>
+void listDirectory( const std::string &path, F &&f )
+{
+	std::unique_ptr<DIR, DirCloser> dir( opendir( path.c_str() ) );
+	if( !dir )
+	{
+		throw IOException( boost::str( boost::format( "Unable to open directory \"%s\"" ) % path ) );
+	}
+
+	while( const dirent *entry = readdir( dir.get() ) )
+	{
+		const char *name = entry->d_name;
+		if( name[0] == '.' && ( name[1] == '\0' || ( name[1] == '.' && name[2] == '\0' ) ) )
+		{
+			continue;
+		}
+		f( name, strlen( name ) );
+	}
+}
+
+#endif
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Public functions
+//////////////////////////////////////////////////////////////////////////
+
+void IECore::findSequences( const std::vector< std::string > &names, std::vector< FileSequencePtr > &sequences, size_t minSequenceSize )
+{
+	SequenceBuilder builder;
+	for( const auto &name : names )
+	{
+		builder.add( name.c_str(), name.size() );
+	}
+
+	builder.sequences( sequences, minSequenceSize );
+}
+
 void IECore::findSequences( const std::vector< std::string > &names, std::vector< FileSequencePtr > &sequences )
 {
 	/// ignore any sequences with less than two files
@@ -194,17 +492,37 @@ void IECore::ls( const std::string &path, std::vector< FileSequencePtr > &sequen
 
 	if ( boost::filesystem::is_directory( path ) )
 	{
-		boost::filesystem::directory_iterator end;
-	 	std::vector< std::string > files;
-		for ( boost::filesystem::directory_iterator it( path ); it != end; ++it )
-		{
-			files.push_back( it->path().PATH_TO_STRING );
-		}
+		NameStorage storage;
+		SequenceBuilder builder;
+		listDirectory(
+			path,
+			[&storage, &builder]( const char *name, size_t size ) {
+				builder.add( storage.add( name, size ), size );
+			}
+		);
 
-		findSequences( files, sequences, minSequenceSize );
+		builder.sequences( sequences, minSequenceSize );
 	}
 }
 
+void IECore::ls( const std::vector< std::string > &paths, std::vector< std::vector< FileSequencePtr > > &sequences, size_t minSequenceSize )
+{
+	sequences.clear();
+	sequences.resize( paths.size() );
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, paths.size(), 1 ),
+		[&paths, &sequences, minSequenceSize]( const tbb::blocked_range<size_t> &range ) {
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				ls( paths[i], sequences[i], minSequenceSize );
+			}
+		},
+		taskGroupContext
+	);
+}
+
 void IECore::ls( const std::string &sequencePath, FileSequencePtr &sequence, size_t minSequenceSize )
 {
 	sequence = nullptr;
@@ -238,17 +556,16 @@ void IECore::ls( const std::string &sequencePath, FileSequencePtr &sequence, siz
 		dirToCheck = ".";
 	}
 
-	boost::filesystem::directory_iterator end;
-
-	for ( boost::filesystem::directory_iterator it( dirToCheck ); it != end; ++it )
-	{
-		const std::string fileName = it->path().PATH_TO_STRING;
-
-		if ( fileName.size() >= std::min( prefix.size(), suffix.size() ) && fileName.substr( 0, prefix.size() ) == prefix && fileName.substr( fileName.size() - suffix.size(), suffix.size() ) == suffix )
-		{
-			files.push_back( ( dir / boost::filesystem::path( fileName ) ).string() );
+	listDirectory(
+		dirToCheck.string(),
+		[&]( const char *name, size_t size ) {
+			const std::string fileName( name, size );
+			if ( fileName.size() >= std::min( prefix.size(), suffix.size() ) && fileName.substr( 0, prefix.size() ) == prefix && fileName.substr( fileName.size() - suffix.size(), suffix.size() ) == suffix )
+			{
+				files.push_back( ( dir / boost::filesystem::path( fileName ) ).string() );
+			}
 		}
-	}
+	);
 
 	std::vector< FileSequencePtr > sequences;
 	findSequences( files, sequences, minSequenceSize );
@@ -54,90 +54,84 @@ LensModel::~LensModel()
 {
 }
 
-Imath::Box2i LensModel::bounds( int mode, const Imath::Box2i &input, int width, int height )
+namespace
+{
+
+void extendBounds( const Imath::V2d &p, int width, int height, Imath::Box2i &bound )
 {
-	Imath::Box2i out( input );
-	bool init( false );
+	if( std::isinf( p.x ) || std::isinf( p.y ) || std::isnan( p.x ) || std::isnan( p.y ) )
+	{
+		return;
+	}
+
+	bound.extendBy(
+		Imath::V2i(
+			int( floor( p.x * width - 0.5 ) ),
+			int( floor( p.y * height - 0.5 ) )
+		)
+	);
+}
+
+} // namespace
 
+Imath::Box2i LensModel::bounds( int mode, const Imath::Box2i &input, int width, int height )
+{
+	// Gather the points on the border of the input and
+	// transform them all at once.
+	std::vector<Imath::V2d> points;
+	points.reserve( 2 * ( input.size().x + 1 ) + 2 * ( input.size().y + 1 ) );
 	for( int i = input.min.x; i <= input.max.x; ++i )
 	{
-		for( int pass = 0; pass < 2; ++pass )
-		{
-			double x = ( double(i) + 0.5 ) / width;
-			double y = ( double( pass == 0 ? input.min.y : input.max.y ) + 0.5 ) / height;
-
-			Imath::V2d pIn( x, y );
-			Imath::V2d pOut( 0, 0 );
-
-			if( mode == Distort )
-			{
-				pOut = distort( pIn );
-			}
-			else
-			{
-				pOut = undistort( pIn );
-			}
-
-			if( !std::isinf( pOut.x ) && !std::isinf( pOut.y ) && !std::isnan( pOut.x ) && !std::isnan( pOut.y ) )
-			{
-				pOut.x = pOut.x*width-0.5;
-				pOut.y = pOut.y*height-0.5;
-				if( !init )
-				{
-					out.min.x = int( floor( pOut.x ) );
-					out.min.y = int( floor( pOut.y ) );
-					out.max.x = int( floor( pOut.x ) );
-					out.max.y = int( floor( pOut.y ) );
-					init = true;
-				}
-				else
-				{
-					out.min.x = std::min( int( floor( pOut.x ) ), out.min.x );
-					out.min.y = std::min( int( floor( pOut.y ) ), out.min.y );
-					out.max.x = std::max( int( floor( pOut.x ) ), out.max.x );
-					out.max.y = std::max( int( floor( pOut.y ) ), out.max.y );
-				}
-			}
-		}
+		const double x = ( double( i ) + 0.5 ) / width;
+		points.push_back( Imath::V2d( x, ( double( input.min.y ) + 0.5 ) / height ) );
+		points.push_back( Imath::V2d( x, ( double( input.max.y ) + 0.5 ) / height ) );
+	}
+	for( int j = input.min.y; j <= input.max.y; ++j )
+	{
+		const double y = ( double( j ) + 0.5 ) / height;
+		points.push_back( Imath::V2d( ( double( input.min.x ) + 0.5 ) / width, y ) );
+		points.push_back( Imath::V2d( ( double( input.max.x ) + 0.5 ) / width, y ) );
 	}
 
-	if ( !init ) return Imath::Box2i( Imath::V2i(0,0), Imath::V2i(0,0) );
+	if( mode == Distort )
+	{
+		distortPoints( points.data(), points.data(), points.size() );
+	}
+	else
+	{
+		undistortPoints( points.data(), points.data(), points.size() );
+	}
+
+	Imath::Box2i out;
+	for( const auto &p : points )
+	{
+		extendBounds( p, width, height, out );
+	}
 
-	for( int j = input.min.y; j <= input.max.y; j++ )
+	if( out.isEmpty() )
 	{
-		for( int pass = 0; pass < 2; pass++ )
-		{
-			double x = ( double( pass == 0 ? input.min.x : input.max.x ) + 0.5 ) / width;
-			double y = ( double(j) + 0.5 ) / height;
-
-			Imath::V2d pIn( x, y );
-			Imath::V2d pOut( 0, 0 );
-
-			if( mode == Distort )
-			{
-				pOut = distort( pIn );
-			}
-			else
-			{
-				pOut = undistort( pIn );
-			}
-
-			if( !std::isinf( pOut.x ) && !std::isinf( pOut.y ) && !std::isnan( pOut.x ) && !std::isnan( pOut.y ) )
-			{
-				pOut.x = pOut.x*width-0.5;
-				pOut.y = pOut.y*height-0.5;
-
-				out.min.x = std::min( int( floor( pOut.x ) ), out.min.x );
-				out.min.y = std::min( int( floor( pOut.y ) ), out.min.y );
-				out.max.x = std::max( int( floor( pOut.x ) ), out.max.x );
-				out.max.y = std::max( int( floor( pOut.y ) ), out.max.y );
-			}
-		}
+		return Imath::Box2i( Imath::V2i( 0, 0 ), Imath::V2i( 0, 0 ) );
 	}
 
 	return out;
 }
 
+void LensModel::distortPoints( const Imath::V2d *in, Imath::V2d *out, size_t count )
+{
+	for( size_t i = 0; i < count; ++i )
+	{
+		out[i] = distort( in[i] );
+	}
+}
+
+void LensModel::undistortPoints( const Imath::V2d *in, Imath::V2d *out, size_t count )
+{
+	for( size_t i = 0; i < count; ++i )
+	{
+		out[i] = undistort( in[i] );
+	}
+}
+
 LensModelPtr LensModel::create( const std::string &name )
 {
 	// Check to see whether the requested lens model is registered and if not, throw an exception.
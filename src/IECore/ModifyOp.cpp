@@ -97,12 +97,17 @@ const BoolParameter *ModifyOp::enableParameter() const
 	return m_enableParameter.get();
 }
 
+bool ModifyOp::replacesModifiedMembers() const
+{
+	return false;
+}
+
 ObjectPtr ModifyOp::doOperation( const CompoundObject *operands )
 {
 	ObjectPtr object = m_inputParameter->getValue();
 	if( m_copyParameter->getTypedValue() )
 	{
-		object = object->copy();
+		object = replacesModifiedMembers() ? object->shallowCopy() : object->copy();
 	}
 	if( m_enableParameter->getTypedValue() )
 	{
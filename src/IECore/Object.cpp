@@ -37,9 +37,17 @@
 #include "IECore/MurmurHash.h"
 
 #include "boost/format.hpp"
+#include "boost/functional/hash.hpp"
 #include "boost/tokenizer.hpp"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
 
 
 using namespace IECore;
@@ -77,8 +85,10 @@ namespace
 
 struct TypeInformation
 {
-	typedef std::map< TypeId, Object::CreatorFn > TypeIdsToCreatorsMap;
-	typedef std::map< std::string, Object::CreatorFn > TypeNamesToCreatorsMap;
+	// Hashed by int, since std::hash isn't guaranteed
+	// to be specialised for enums in C++11.
+	typedef std::unordered_map< TypeId, Object::CreatorFn, std::hash<int> > TypeIdsToCreatorsMap;
+	typedef std::unordered_map< std::string, Object::CreatorFn > TypeNamesToCreatorsMap;
 
 	TypeIdsToCreatorsMap typeIdsToCreators;
 	TypeNamesToCreatorsMap typeNamesToCreators;
@@ -102,11 +112,12 @@ TypeInformation *typeInformation()
 // copy context stuff
 //////////////////////////////////////////////////////////////////////////////////////////
 
-struct Object::CopyContext::CopiedObjects : public std::map<const Object *, Object *>
+struct Object::CopyContext::CopiedObjects : public std::unordered_map<const Object *, Object *>
 {
 };
 
 Object::CopyContext::CopyContext()
+	:	m_shallow( false )
 {
 }
 
@@ -116,6 +127,12 @@ Object::CopyContext::~CopyContext()
 
 ObjectPtr Object::CopyContext::copyInternal( const Object *toCopy )
 {
+	if( m_shallow )
+	{
+		// Member objects are shared with the original.
+		return const_cast<Object *>( toCopy );
+	}
+
 	if( toCopy->refCount() > 1 )
 	{
 		// object may occur multiple times in the data structure
@@ -148,7 +165,7 @@ ObjectPtr Object::CopyContext::copyInternal( const Object *toCopy )
 // save context stuff
 //////////////////////////////////////////////////////////////////////////////////////////
 
-struct Object::SaveContext::SavedObjects : public std::map<const Object *, IndexedIO::EntryIDList >
+struct Object::SaveContext::SavedObjects : public std::unordered_map<const Object *, IndexedIO::EntryIDList >
 {
 };
 
@@ -224,8 +241,33 @@ void Object::SaveContext::save( const Object *toSave, IndexedIO *container, cons
 // load context stuff
 //////////////////////////////////////////////////////////////////////////////////////////
 
-struct Object::LoadContext::LoadedObjects : public std::map<IndexedIO::EntryIDList, ObjectPtr>
+namespace
+{
+
+// InternedStrings are unique, so we can hash their addresses
+// rather than their contents.
+struct EntryIDListHash
 {
+	size_t operator()( const IndexedIO::EntryIDList &path ) const
+	{
+		size_t result = 0;
+		for( IndexedIO::EntryIDList::const_iterator it = path.begin(), eIt = path.end(); it != eIt; ++it )
+		{
+			boost::hash_combine( result, it->c_str() );
+		}
+		return result;
+	}
+};
+
+} // namespace
+
+// Objects are entered into the map with a null value while they are being
+// loaded. The mutex protects the map when loading objects in parallel, and
+// `loaded` is notified whenever a load completes.
+struct Object::LoadContext::LoadedObjects : public std::unordered_map<IndexedIO::EntryIDList, ObjectPtr, EntryIDListHash>
+{
+	std::mutex mutex;
+	std::condition_variable loaded;
 };
 
 Object::LoadContext::LoadContext( ConstIndexedIOPtr ioInterface )
@@ -233,8 +275,8 @@ Object::LoadContext::LoadContext( ConstIndexedIOPtr ioInterface )
 {
 }
 
-Object::LoadContext::LoadContext( ConstIndexedIOPtr ioInterface, std::shared_ptr<LoadedObjects> loadedObjects )
-	:	m_ioInterface( ioInterface ), m_loadedObjects( loadedObjects )
+Object::LoadContext::LoadContext( ConstIndexedIOPtr ioInterface, std::shared_ptr<LoadedObjects> loadedObjects, const LoadContext *parent, const IndexedIO::EntryIDList &path )
+	:	m_ioInterface( ioInterface ), m_loadedObjects( loadedObjects ), m_parent( parent ), m_path( path )
 {
 }
 
@@ -287,15 +329,9 @@ ObjectPtr Object::LoadContext::loadObjectOrReference( const IndexedIO *container
 				pathParts.push_back( *t );
 			}
 		}
-		std::pair<LoadedObjects::iterator, bool> ret = m_loadedObjects->insert( std::pair<IndexedIO::EntryIDList, ObjectPtr>( pathParts, nullptr ) );
-		if ( ret.second )
-		{
-			// jump to the path..
-			ConstIndexedIOPtr ioObject = m_ioInterface->directory( pathParts );
-			// add the loaded object to the map.
-			ret.first->second = loadObject( ioObject.get() );
-		}
-		return ret.first->second;
+		// jump to the path..
+		ConstIndexedIOPtr ioObject = m_ioInterface->directory( pathParts );
+		return loadObject( ioObject.get(), pathParts );
 	}
 	else
 	{
@@ -304,30 +340,111 @@ ObjectPtr Object::LoadContext::loadObjectOrReference( const IndexedIO *container
 		IndexedIO::EntryIDList pathParts;
 		ioObject->path( pathParts );
 
-		std::pair<LoadedObjects::iterator, bool> ret = m_loadedObjects->insert( std::pair<IndexedIO::EntryIDList, ObjectPtr>( pathParts, nullptr ) );
-		if ( ret.second )
+		return loadObject( ioObject.get(), pathParts );
+	}
+}
+
+void Object::LoadContext::loadObjectsOrReferences( const IndexedIO *container, const IndexedIO::EntryIDList &names, std::vector<ObjectPtr> &objects )
+{
+	objects.resize( names.size() );
+
+	// IndexedIO only supports concurrent access to files that aren't being written.
+	if( names.size() < 2 || ( container->openMode() & ( IndexedIO::Write | IndexedIO::Append ) ) )
+	{
+		for( size_t i = 0, e = names.size(); i < e; ++i )
 		{
-			// add the loaded object to the map.
-			ret.first->second = loadObject( ioObject.get() );
+			objects[i] = loadObjectOrReference( container, names[i] );
 		}
-		return ret.first->second;
+		return;
 	}
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, names.size() ),
+		[&]( const tbb::blocked_range<size_t> &range ) {
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				// Isolation prevents this thread from picking up unrelated
+				// tasks while waiting on nested loads. Without it, we could
+				// end up waiting in `loadObject()` for an object further up
+				// our own stack.
+				tbb::this_task_arena::isolate(
+					[&] { objects[i] = loadObjectOrReference( container, names[i] ); }
+				);
+			}
+		},
+		taskGroupContext
+	);
 }
 
 // this function can only load concrete objects. it can't load references to
-// objects. path is relative to the root of m_ioInterface
-ObjectPtr Object::LoadContext::loadObject( const IndexedIO *container )
+// objects. path is the path of container, relative to the root of m_ioInterface
+ObjectPtr Object::LoadContext::loadObject( const IndexedIO *container, const IndexedIO::EntryIDList &path )
 {
+	{
+		std::unique_lock<std::mutex> lock( m_loadedObjects->mutex );
+		while( true )
+		{
+			std::pair<LoadedObjects::iterator, bool> ret = m_loadedObjects->insert( std::pair<IndexedIO::EntryIDList, ObjectPtr>( path, nullptr ) );
+			if( ret.second )
+			{
+				// We're responsible for loading it.
+				break;
+			}
+			if( ret.first->second || loading( path ) )
+			{
+				// Either already loaded, or a cyclic reference to an object
+				// we're still loading, in which case we return null as we
+				// always have.
+				return ret.first->second;
+			}
+			// Being loaded on another thread - wait for it, so that all
+			// references share the same object.
+			m_loadedObjects->loaded.wait( lock );
+		}
+	}
+
 	ObjectPtr result = nullptr;
-	string type = "";
-	container->read( g_typeEntry, type );
-	ConstIndexedIOPtr dataIO = container->subdirectory( g_dataEntry );
-	result = create( type );
-	LoadContextPtr context = new LoadContext( dataIO, m_loadedObjects );
-	result->load( context );
+	try
+	{
+		string type = "";
+		container->read( g_typeEntry, type );
+		ConstIndexedIOPtr dataIO = container->subdirectory( g_dataEntry );
+		result = create( type );
+		LoadContextPtr context = new LoadContext( dataIO, m_loadedObjects, this, path );
+		result->load( context );
+	}
+	catch( ... )
+	{
+		// Remove our entry so that anyone waiting on it can try for themselves.
+		{
+			std::lock_guard<std::mutex> lock( m_loadedObjects->mutex );
+			m_loadedObjects->erase( path );
+		}
+		m_loadedObjects->loaded.notify_all();
+		throw;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock( m_loadedObjects->mutex );
+		(*m_loadedObjects)[path] = result;
+	}
+	m_loadedObjects->loaded.notify_all();
 	return result;
 }
 
+bool Object::LoadContext::loading( const IndexedIO::EntryIDList &path ) const
+{
+	for( const LoadContext *c = this; c; c = c->m_parent.get() )
+	{
+		if( c->m_path == path )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // memory accumulator stuff
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -402,6 +519,15 @@ ObjectPtr Object::copy() const
 	return result;
 }
 
+ObjectPtr Object::shallowCopy() const
+{
+	CopyContext c;
+	c.m_shallow = true;
+	ObjectPtr result = create( typeId() );
+	result->copyFrom( this, &c );
+	return result;
+}
+
 void Object::save( IndexedIOPtr ioInterface, const IndexedIO::EntryID &name ) const
 {
 	boost::shared_ptr<SaveContext> context( new SaveContext( ioInterface ) );
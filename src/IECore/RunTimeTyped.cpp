@@ -38,14 +38,36 @@
 
 #include "boost/format.hpp"
 
-#include "tbb/mutex.h"
+#include "tbb/concurrent_unordered_map.h"
 
 #include <cassert>
 
 using namespace IECore;
 
-RunTimeTyped::Mutex RunTimeTyped::g_baseTypeIdsMutex;
-RunTimeTyped::Mutex RunTimeTyped::g_derivedTypeIdsMutex;
+namespace
+{
+
+// The complete lists of base and derived types are computed on demand
+// and stored in these maps, which support concurrent lookups and
+// insertions without locking. Elements are never erased, so the
+// references returned by baseTypeIds() and derivedTypeIds() remain
+// valid forever.
+typedef tbb::concurrent_unordered_map<TypeId, std::vector<TypeId>> CompleteBaseTypesMap;
+typedef tbb::concurrent_unordered_map<TypeId, std::set<TypeId>> CompleteDerivedTypesMap;
+
+CompleteBaseTypesMap &completeBaseTypes()
+{
+	static CompleteBaseTypesMap *m = new CompleteBaseTypesMap();
+	return *m;
+}
+
+CompleteDerivedTypesMap &completeDerivedTypes()
+{
+	static CompleteDerivedTypesMap *m = new CompleteDerivedTypesMap();
+	return *m;
+}
+
+} // namespace
 
 RunTimeTyped::RunTimeTyped()
 {
@@ -216,49 +238,40 @@ TypeId RunTimeTyped::baseTypeId( TypeId typeId )
 
 const std::vector<TypeId> &RunTimeTyped::baseTypeIds( TypeId typeId )
 {
-	Mutex::scoped_lock lock( g_baseTypeIdsMutex, false ); // read-only lock
-	BaseTypesRegistryMap &baseTypes = completeBaseTypesRegistry();
-
-	BaseTypesRegistryMap::iterator it = baseTypes.find( typeId );
-	if ( it != baseTypes.end() )
+	CompleteBaseTypesMap &baseTypes = completeBaseTypes();
+	CompleteBaseTypesMap::const_iterator it = baseTypes.find( typeId );
+	if( it != baseTypes.end() )
 	{
 		return it->second;
 	}
 
-	lock.upgrade_to_writer();
-
-	baseTypes.insert( BaseTypesRegistryMap::value_type( typeId, std::vector<TypeId>() ) );
-	it = baseTypes.find( typeId );
-	assert( it != baseTypes.end() );
-
+	std::vector<TypeId> typeIds;
 	TypeId baseType = baseTypeId( typeId );
 	while ( baseType != InvalidTypeId )
 	{
-		it->second.push_back( baseType );
+		typeIds.push_back( baseType );
 		baseType = baseTypeId( baseType );
 	}
 
-	return it->second;
+	// If another thread got here first, insert() returns
+	// their (identical) result rather than ours.
+	return baseTypes.insert( CompleteBaseTypesMap::value_type( typeId, typeIds ) ).first->second;
 }
 
 const std::set<TypeId> &RunTimeTyped::derivedTypeIds( TypeId typeId )
 {
-	Mutex::scoped_lock lock( g_derivedTypeIdsMutex, false ); // read-only lock
-	DerivedTypesRegistryMap &derivedTypes = completeDerivedTypesRegistry();
-	DerivedTypesRegistryMap::iterator it = derivedTypes.find( typeId );
-
-	if ( it == derivedTypes.end() )
+	CompleteDerivedTypesMap &derivedTypes = completeDerivedTypes();
+	CompleteDerivedTypesMap::const_iterator it = derivedTypes.find( typeId );
+	if( it != derivedTypes.end() )
 	{
-		lock.upgrade_to_writer();
-		derivedTypes.insert( DerivedTypesRegistryMap::value_type( typeId, std::set<TypeId>() ) );
-		it = derivedTypes.find( typeId );
-		assert( it != derivedTypes.end() );
-
-		// Walk over the hierarchy of derived types
-		derivedTypeIdsWalk( typeId, it->second );
+		return it->second;
 	}
 
-	return it->second;
+	// Walk over the hierarchy of derived types
+	std::set<TypeId> typeIds;
+	derivedTypeIdsWalk( typeId, typeIds );
+
+	return derivedTypes.insert( CompleteDerivedTypesMap::value_type( typeId, typeIds ) ).first->second;
 }
 
 void RunTimeTyped::derivedTypeIdsWalk( TypeId typeId, std::set<TypeId> &typeIds )
@@ -280,20 +293,6 @@ void RunTimeTyped::derivedTypeIdsWalk( TypeId typeId, std::set<TypeId> &typeIds
 	}
 }
 
-RunTimeTyped::BaseTypesRegistryMap &RunTimeTyped::completeBaseTypesRegistry()
-{
-	static BaseTypesRegistryMap *baseTypes = new BaseTypesRegistryMap();
-	assert( baseTypes );
-	return *baseTypes;
-}
-
-RunTimeTyped::DerivedTypesRegistryMap &RunTimeTyped::completeDerivedTypesRegistry()
-{
-	static DerivedTypesRegistryMap *derivedTypes = new DerivedTypesRegistryMap();
-	assert( derivedTypes );
-	return *derivedTypes;
-}
-
 TypeId RunTimeTyped::typeIdFromTypeName( const char *typeName )
 {
 	assert( typeName );
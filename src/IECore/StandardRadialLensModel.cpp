@@ -36,6 +36,9 @@
 
 #include "IECore/NumericParameter.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
 namespace IECore
 {
 
@@ -139,7 +142,7 @@ void StandardRadialLensModel::validate()
 	m_cyyy = quarticDistortion;
 }
 
-Imath::V2d StandardRadialLensModel::undistort( Imath::V2d p )
+inline Imath::V2d StandardRadialLensModel::undistortInternal( const Imath::V2d &p ) const
 {
 	Imath::V2d dn( UVtoDN( p ) );
 
@@ -154,7 +157,7 @@ Imath::V2d StandardRadialLensModel::undistort( Imath::V2d p )
 	return DNtoUV( dn );
 }
 
-Imath::V2d StandardRadialLensModel::distort( Imath::V2d p )
+inline Imath::V2d StandardRadialLensModel::distortInternal( const Imath::V2d &p ) const
 {
 	Imath::V2d dn( UVtoDN( p ) );
 	const Imath::V2d dnl( dn );
@@ -182,9 +185,53 @@ Imath::V2d StandardRadialLensModel::distort( Imath::V2d p )
 	return DNtoUV( dn );
 }
 
+Imath::V2d StandardRadialLensModel::undistort( Imath::V2d p )
+{
+	return undistortInternal( p );
+}
+
+Imath::V2d StandardRadialLensModel::distort( Imath::V2d p )
+{
+	return distortInternal( p );
+}
+
+void StandardRadialLensModel::distortPoints( const Imath::V2d *in, Imath::V2d *out, size_t count )
+{
+	// Unlike the default implementation, this runs in parallel, and calls
+	// distortInternal() directly so that it can be inlined into the loop.
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, count ),
+		[this, in, out]( const tbb::blocked_range<size_t> &range )
+		{
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				out[i] = distortInternal( in[i] );
+			}
+		},
+		taskGroupContext
+	);
+}
+
+void StandardRadialLensModel::undistortPoints( const Imath::V2d *in, Imath::V2d *out, size_t count )
+{
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, count ),
+		[this, in, out]( const tbb::blocked_range<size_t> &range )
+		{
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				out[i] = undistortInternal( in[i] );
+			}
+		},
+		taskGroupContext
+	);
+}
+
 // Transforms UV coordinates in the range 0-1 to the dimesionless
 // coordinates which are used by the distortion algorithm.
-Imath::V2d StandardRadialLensModel::UVtoDN( const Imath::V2d& uv )
+Imath::V2d StandardRadialLensModel::UVtoDN( const Imath::V2d& uv ) const
 {
 	// Convert the UV coordinates to FOV coordinates.
 	// FOV coordinates range from -1 to 1 in both axis.
@@ -198,7 +245,7 @@ Imath::V2d StandardRadialLensModel::UVtoDN( const Imath::V2d& uv )
 
 // Transforms the dimesionless coordinates that are used by the
 // distortion algorithm to UV coordinates in the range of 0-1.
-Imath::V2d StandardRadialLensModel::DNtoUV( const Imath::V2d& dn )
+Imath::V2d StandardRadialLensModel::DNtoUV( const Imath::V2d& dn ) const
 {
 	// Convert the dimesionless coordinates to FOV coordinates.
 	// FOV coordinates range from -1 to 1 in both axis.
@@ -45,6 +45,9 @@
 
 #include "blosc.h"
 
+#include "tbb/atomic.h"
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
 #include "tbb/spin_rw_mutex.h"
 
 #include "boost/format.hpp"
@@ -416,65 +419,116 @@ size_t compress(
 		return 0;
 	}
 
-	size_t bytesToCompress = size;
-	const char *currentBlockCompressed = data;
-
-	size_t numBlocks = 0;
-
-	/// this isn't enough space in some edge cases but is sufficient in the common case
-	/// and we check if we have enough size in the compression loop
-	outputBuffer.resize( size + BLOSC_MAX_OVERHEAD );
-	char *writePtr = outputBuffer.data();
-	size_t writerBufferBytes = outputBuffer.size();
-
-	size_t totalCompressedSize = 0;
-
-	while ( bytesToCompress )
-	{
-		size_t currentBlockUncompressedSize = std::min( maxCompressedBlockSize, bytesToCompress );
-		size_t compressedBufferMaxSize = currentBlockUncompressedSize + BLOSC_MAX_OVERHEAD;
-		if( writerBufferBytes < compressedBufferMaxSize )
-		{
-			size_t additionalBytes = (size_t) ( compressedBufferMaxSize - writerBufferBytes );
-			outputBuffer.resize( outputBuffer.size() + additionalBytes );
-		}
-
+	// Blocks are compressed independently, so we can compress them in
+	// parallel and concatenate the results in order, producing exactly
+	// the same output as compressing them one after another.
+	auto compressBlock = [&]( size_t blockIndex, std::vector<char> &blockBuffer ) {
+		const size_t offset = blockIndex * maxCompressedBlockSize;
+		const size_t blockSize = std::min( maxCompressedBlockSize, size - offset );
+		blockBuffer.resize( blockSize + BLOSC_MAX_OVERHEAD );
 		int compressedSize = blosc_compress_ctx(
 			compressionLevel,
 			true,
 			4,
-			currentBlockUncompressedSize,
-			currentBlockCompressed,
-			writePtr,
-			compressedBufferMaxSize,
+			blockSize,
+			data + offset,
+			blockBuffer.data(),
+			blockBuffer.size(),
 			compressor.c_str(),
 			0,
 			threadCount
 		);
+		blockBuffer.resize( std::max( compressedSize, 0 ) );
+		return compressedSize >= 0;
+	};
 
-		if ( compressedSize < 0 )
+	const size_t numBlocks = ( size + maxCompressedBlockSize - 1 ) / maxCompressedBlockSize;
+	if( numBlocks == 1 )
+	{
+		if( !compressBlock( 0, outputBuffer ) )
 		{
 			outputBuffer.clear();
 			return 0;
 		}
+		return 1;
+	}
 
-		writerBufferBytes -= compressedSize;
-		writePtr += compressedSize;
-
-		totalCompressedSize += compressedSize;
+	std::vector<std::vector<char>> blockBuffers( numBlocks );
+	tbb::atomic<bool> failed;
+	failed = false;
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, numBlocks ),
+		[&]( const tbb::blocked_range<size_t> &range ) {
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				if( !compressBlock( i, blockBuffers[i] ) )
+				{
+					failed = true;
+				}
+			}
+		},
+		taskGroupContext
+	);
 
-		currentBlockCompressed += currentBlockUncompressedSize;
-		bytesToCompress -= currentBlockUncompressedSize;
-		numBlocks++;
+	outputBuffer.clear();
+	if( failed )
+	{
+		return 0;
 	}
 
-	// if we've compressed all the input then just set the
-	// output buffer
-	outputBuffer.resize( totalCompressedSize );
+	size_t totalCompressedSize = 0;
+	for( const auto &b : blockBuffers )
+	{
+		totalCompressedSize += b.size();
+	}
+	outputBuffer.reserve( totalCompressedSize );
+	for( const auto &b : blockBuffers )
+	{
+		outputBuffer.insert( outputBuffer.end(), b.begin(), b.end() );
+	}
 
 	return numBlocks;
 }
 
+/// Returns a hash of 'size' bytes at 'data', used to detect duplicate data
+/// blocks when writing. Large buffers are hashed in parallel, one chunk per
+/// task, so the result differs from a single MurmurHash of the buffer. That's
+/// fine because it only needs to be consistent within one process - hashes are
+/// never stored in the file.
+MurmurHash hashData( const char *data, size_t size )
+{
+	const size_t chunkSize = 1024 * 1024;
+
+	MurmurHash result;
+	if( size <= chunkSize )
+	{
+		result.append( data, size );
+		return result;
+	}
+
+	std::vector<MurmurHash> chunkHashes( ( size + chunkSize - 1 ) / chunkSize );
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, chunkHashes.size() ),
+		[&]( const tbb::blocked_range<size_t> &range ) {
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				const size_t offset = i * chunkSize;
+				chunkHashes[i].append( data + offset, std::min( chunkSize, size - offset ) );
+			}
+		},
+		taskGroupContext
+	);
+
+	for( const auto &h : chunkHashes )
+	{
+		result.append( h );
+	}
+	result.append( (uint64_t)size );
+	return result;
+}
+
 /// decompress a memory buffer which is formed by a number of blosc compressed blocks
 /// returns the number of compression blocks
 /// 'outputBuffer' contains the decompressed data and is resized in this function if not large enough.
@@ -2498,8 +2552,7 @@ Imf::Int64 StreamIndexedIO::Index::writeUniqueData( const char *data, size_t siz
 	Imf::Int64 loc;
 
 	// compute hash for the data
-	MurmurHash hash;
-	hash.append( data, size );
+	const MurmurHash hash = hashData( data, size );
 
 	if ( size >= UINT32_MAX )
 	{
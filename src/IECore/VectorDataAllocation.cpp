@@ -0,0 +1,135 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2019, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//
+//     * Neither the name of Image Engine Design nor the names of any
+//       other contributors to this software may be used to endorse or
+//       promote products derived from this software without specific prior
+//       written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "IECore/VectorDataAllocation.h"
+
+#include "IECore/MessageHandler.h"
+
+#include "boost/format.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace IECore;
+
+namespace
+{
+
+size_t defaultHugePageThreshold()
+{
+	const char *t = getenv( "IECORE_VECTORDATA_HUGEPAGE_THRESHOLD" );
+	if( !t || !*t )
+	{
+		return 0;
+	}
+
+	char *end = nullptr;
+	errno = 0;
+	const unsigned long long megabytes = strtoull( t, &end, 10 );
+	if( errno || *end || strchr( t, '-' ) || megabytes > std::numeric_limits<size_t>::max() / ( 1024 * 1024 ) )
+	{
+		msg( Msg::Warning, "VectorDataAllocation", boost::format( "Invalid value \"%s\" for IECORE_VECTORDATA_HUGEPAGE_THRESHOLD. Huge pages will not be used." ) % t );
+		return 0;
+	}
+
+	return megabytes * 1024 * 1024;
+}
+
+// Initialised on first use rather than during static initialisation,
+// so that the warning for a bad environment variable is emitted
+// safely, once the message handler exists.
+std::atomic<size_t> &hugePageThreshold()
+{
+	static std::atomic<size_t> g_hugePageThreshold( defaultHugePageThreshold() );
+	return g_hugePageThreshold;
+}
+
+std::atomic<size_t> g_hugePageAdvisedBytes( 0 );
+
+} // namespace
+
+void VectorDataAllocation::setHugePageThreshold( size_t bytes )
+{
+	hugePageThreshold() = bytes;
+}
+
+size_t VectorDataAllocation::getHugePageThreshold()
+{
+	return hugePageThreshold();
+}
+
+bool VectorDataAllocation::advise( void *data, size_t bytes )
+{
+	const size_t threshold = hugePageThreshold();
+	if( !threshold || bytes < threshold || !data )
+	{
+		return false;
+	}
+
+#ifdef MADV_HUGEPAGE
+	// madvise() requires a page aligned start address, so we
+	// restrict ourselves to the whole pages inside the range.
+	static const uintptr_t pageSize = sysconf( _SC_PAGESIZE );
+	const uintptr_t begin = ( reinterpret_cast<uintptr_t>( data ) + pageSize - 1 ) & ~( pageSize - 1 );
+	const uintptr_t end = ( reinterpret_cast<uintptr_t>( data ) + bytes ) & ~( pageSize - 1 );
+	if( end <= begin )
+	{
+		return false;
+	}
+
+	if( madvise( reinterpret_cast<void *>( begin ), end - begin, MADV_HUGEPAGE ) != 0 )
+	{
+		// Not fatal - the kernel may have been built without
+		// transparent huge page support.
+		return false;
+	}
+
+	g_hugePageAdvisedBytes += end - begin;
+	return true;
+#else
+	return false;
+#endif
+}
+
+size_t VectorDataAllocation::hugePageAdvisedBytes()
+{
+	return g_hugePageAdvisedBytes;
+}
@@ -100,7 +100,7 @@ static IndexedIO::EntryID g_sizeEntry("size");
 		{																							\
 			const IndexedIO *container = context->rawContainer();									\
 			IndexedIO::Entry e = container->entry( g_valueEntry );									\
-			writable().resize( e.arrayLength() / N );												\
+			VectorDataAllocation::resize( writable(), e.arrayLength() / N );						\
 			if ( e.arrayLength() ) 																	\
 			{ 																						\
 				TNAME::BaseType *p = baseWritable(); 												\
@@ -113,7 +113,7 @@ static IndexedIO::EntryID g_sizeEntry("size");
 			unsigned int v = 0;																		\
 			ConstIndexedIOPtr container = context->container( FALLBACKNAME::staticTypeName(), v );				\
 			IndexedIO::Entry e = container->entry( g_valueEntry );									\
-			writable().resize( e.arrayLength() / N );												\
+			VectorDataAllocation::resize( writable(), e.arrayLength() / N );						\
 			if ( e.arrayLength() ) 																	\
 			{ 																						\
 				TNAME::BaseType *p = baseWritable(); 												\
@@ -322,7 +322,7 @@ void ShortVectorData::load( LoadContextPtr context )
 	{
 		/// Version 1 stores the shorts natively
 		IndexedIO::Entry e = container->entry( g_valueEntry );
-		writable().resize( e.arrayLength() );
+		VectorDataAllocation::resize( writable(), e.arrayLength() );
 		short *p = baseWritable();
 		container->read( g_valueEntry, p, e.arrayLength() );
 	}
@@ -364,7 +364,7 @@ void UShortVectorData::load( LoadContextPtr context )
 	{
 		/// Version 1 stores the unsigned shorts natively
 		IndexedIO::Entry e = container->entry( g_valueEntry );
-		writable().resize( e.arrayLength() );
+		VectorDataAllocation::resize( writable(), e.arrayLength() );
 		unsigned short *p = baseWritable();
 		container->read( g_valueEntry, p, e.arrayLength() );
 	}
@@ -37,6 +37,7 @@
 #include "IECoreGL/Camera.h"
 #include "IECoreGL/Group.h"
 #include "IECoreGL/Primitive.h"
+#include "IECoreGL/PrimitiveInstancer.h"
 #include "IECoreGL/Scene.h"
 #include "IECoreGL/State.h"
 #include "IECoreGL/StateComponent.h"
@@ -209,6 +210,9 @@ void DeferredRendererImplementation::attributeEnd()
 		return;
 	}
 	curContext->stateStack.pop_back();
+	// We're returning to the state outside the block, which primitives
+	// from inside the block don't share.
+	curContext->stateEpoch++;
 
 	// recover local transform from group and remove group from stack
 	curContext->transformStack.pop();
@@ -221,6 +225,8 @@ void DeferredRendererImplementation::addState( StateComponentPtr state )
 	RenderContext *curContext = currentContext();
 
 	(*(curContext->stateStack).rbegin())->add( state );
+	// Subsequent primitives can't share the state of earlier ones.
+	curContext->stateEpoch++;
 }
 
 StateComponent *DeferredRendererImplementation::getState( IECore::TypeId type )
@@ -243,6 +249,7 @@ void DeferredRendererImplementation::addUserAttribute( const IECore::InternedStr
 	RenderContext *curContext = currentContext();
 
 	(*(curContext->stateStack).rbegin())->userAttributes()->writable()[ name ] = value;
+	curContext->stateEpoch++;
 }
 
 IECore::Data *DeferredRendererImplementation::getUserAttribute( const IECore::InternedString &name )
@@ -271,6 +278,36 @@ void DeferredRendererImplementation::addPrimitive( ConstPrimitivePtr primitive )
 
 	RenderContext *curContext = currentContext();
 
+	// If an identical primitive has already been added with the same
+	// state, then we can render them both with a single PrimitiveInstancer,
+	// which binds the state only once. Identical primitives are common
+	// because the Renderer shares converted primitives via the
+	// CachedConverter when automatic instancing is on. Because each
+	// instance has its own transform, this works even when the copies are
+	// in different transform blocks, as they are when using the default
+	// implementation of Renderer::primitives() and Renderer::instances().
+	auto it = curContext->instancedPrimitives.find( primitive.get() );
+	if( it != curContext->instancedPrimitives.end() && it->second.stateEpoch == curContext->stateEpoch )
+	{
+		RenderContext::InstancedPrimitive &instanced = it->second;
+		if( !instanced.instancer )
+		{
+			Group *g = instanced.group;
+			PrimitiveInstancerPtr instancer = new PrimitiveInstancer( primitive );
+			instancer->addInstance( g->getTransform() );
+
+			IECoreGL::Group::Mutex::scoped_lock lock( g->mutex() );
+			g->setTransform( M44f() );
+			g->clearChildren();
+			g->addChild( instancer );
+			instanced.instancer = instancer.get();
+		}
+		instanced.instancer->addInstance(
+			curContext->localTransform * curContext->transformStack.top() * instanced.parentWorldInverse
+		);
+		return;
+	}
+
 	GroupPtr g = new Group;
 	g->setTransform( curContext->localTransform );
 	g->setState( new State( **(curContext->stateStack.rbegin()) ) );
@@ -285,6 +322,20 @@ void DeferredRendererImplementation::addPrimitive( ConstPrimitivePtr primitive )
 		IECoreGL::Group::Mutex::scoped_lock lock( curContext->groupStack.top()->mutex() );
 		curContext->groupStack.top()->addChild( g );
 	}
+
+	const M44f &parentWorld = curContext->transformStack.top();
+	if( parentWorld.determinant() != 0.0f )
+	{
+		RenderContext::InstancedPrimitive &instanced = curContext->instancedPrimitives[primitive.get()];
+		instanced.stateEpoch = curContext->stateEpoch;
+		instanced.group = g.get();
+		instanced.parentWorldInverse = parentWorld.inverse();
+		instanced.instancer = nullptr;
+	}
+	else
+	{
+		curContext->instancedPrimitives.erase( primitive.get() );
+	}
 }
 
 void DeferredRendererImplementation::addInstance( GroupPtr grp )
@@ -308,6 +359,156 @@ void DeferredRendererImplementation::addInstance( GroupPtr grp )
 	}
 }
 
+GroupPtr DeferredRendererImplementation::batchGroup()
+{
+	bool visible = static_cast<CameraVisibilityStateComponent *>( getState( CameraVisibilityStateComponent::staticTypeId() ) )->value();
+	if( !visible )
+	{
+		return nullptr;
+	}
+
+	RenderContext *curContext = currentContext();
+
+	// The whole batch shares a single group holding the current transform
+	// and state, so we only copy the state and lock the parent group once,
+	// rather than once per child as addPrimitive() would.
+	GroupPtr batch = new Group;
+	batch->setTransform( curContext->localTransform );
+	batch->setState( new State( **(curContext->stateStack.rbegin()) ) );
+	return batch;
+}
+
+void DeferredRendererImplementation::addBatchGroup( GroupPtr batch )
+{
+	RenderContext *curContext = currentContext();
+	IECoreGL::Group::Mutex::scoped_lock lock( curContext->groupStack.top()->mutex() );
+	curContext->groupStack.top()->addChild( batch );
+}
+
+void DeferredRendererImplementation::addPrimitives( const std::vector<ConstPrimitivePtr> &primitives, const std::vector<Imath::M44f> &transforms )
+{
+	GroupPtr batch = primitives.size() ? batchGroup() : nullptr;
+	if( !batch )
+	{
+		return;
+	}
+
+	// Primitives which appear more than once in the batch are rendered
+	// with a single PrimitiveInstancer, so that the state is bound only
+	// once for all of them.
+	std::unordered_map<const Primitive *, PrimitiveInstancerPtr> instancers;
+	for( const auto &primitive : primitives )
+	{
+		auto inserted = instancers.insert( { primitive.get(), nullptr } );
+		if( !inserted.second && !inserted.first->second )
+		{
+			inserted.first->second = new PrimitiveInstancer( primitive );
+		}
+	}
+
+	for( size_t i = 0, e = primitives.size(); i < e; ++i )
+	{
+		const M44f transform = transforms.empty() ? M44f() : transforms[i];
+		PrimitiveInstancer *instancer = instancers[primitives[i].get()].get();
+		if( instancer )
+		{
+			if( instancer->transforms().empty() )
+			{
+				batch->addChild( instancer );
+			}
+			instancer->addInstance( transform );
+			continue;
+		}
+
+		/// \todo See todo in addPrimitive().
+		RenderablePtr child = boost::const_pointer_cast<Primitive>( primitives[i] );
+		if( transforms.empty() )
+		{
+			batch->addChild( child );
+		}
+		else
+		{
+			GroupPtr g = new Group;
+			g->setTransform( transform );
+			g->addChild( child );
+			batch->addChild( g );
+		}
+	}
+
+	addBatchGroup( batch );
+}
+
+void DeferredRendererImplementation::addInstances( GroupPtr grp, const std::vector<Imath::M44f> &transforms )
+{
+	GroupPtr batch = transforms.size() ? batchGroup() : nullptr;
+	if( !batch )
+	{
+		return;
+	}
+
+	// If the instance just contains primitives, each optionally in its
+	// own group, as is the case for instances made by Renderer, then we
+	// can render each primitive with a single PrimitiveInstancer rather
+	// than rendering the whole instance once per transform. The instancers
+	// are placed in groups with the same states as the originals, and
+	// incorporate the original transforms into their own.
+	bool primitivesOnly = !grp->children().empty();
+	for( const auto &child : grp->children() )
+	{
+		if( IECore::runTimeCast<Primitive>( child.get() ) )
+		{
+			continue;
+		}
+		const Group *childGroup = IECore::runTimeCast<Group>( child.get() );
+		primitivesOnly = childGroup && childGroup->children().size() == 1 && IECore::runTimeCast<Primitive>( childGroup->children().front().get() );
+		if( !primitivesOnly )
+		{
+			break;
+		}
+	}
+
+	if( primitivesOnly )
+	{
+		GroupPtr instancers = new Group;
+		instancers->setState( grp->getState() );
+		for( const auto &child : grp->children() )
+		{
+			GroupPtr parent = instancers;
+			PrimitivePtr primitive = IECore::runTimeCast<Primitive>( child );
+			M44f primitiveTransform = grp->getTransform();
+			if( !primitive )
+			{
+				Group *childGroup = IECore::runTimeCast<Group>( child.get() );
+				primitive = IECore::runTimeCast<Primitive>( childGroup->children().front() );
+				primitiveTransform = childGroup->getTransform() * primitiveTransform;
+				parent = new Group;
+				parent->setState( childGroup->getState() );
+				instancers->addChild( parent );
+			}
+
+			PrimitiveInstancerPtr instancer = new PrimitiveInstancer( primitive );
+			for( const auto &transform : transforms )
+			{
+				instancer->addInstance( primitiveTransform * transform );
+			}
+			parent->addChild( instancer );
+		}
+		batch->addChild( instancers );
+	}
+	else
+	{
+		for( const auto &transform : transforms )
+		{
+			GroupPtr g = new Group;
+			g->setTransform( transform );
+			g->addChild( grp );
+			batch->addChild( g );
+		}
+	}
+
+	addBatchGroup( batch );
+}
+
 // Class that sets the scope of a RenderContext on the renderer thread.
 struct DeferredRendererImplementation::ScopedRenderContext : private boost::noncopyable
 {
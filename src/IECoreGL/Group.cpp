@@ -43,15 +43,150 @@ using namespace IECoreGL;
 using namespace Imath;
 using namespace std;
 
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Incremented whenever any Group is modified, invalidating
+// all cached bounds. This is simpler than propagating
+// invalidations up the hierarchy, which Groups can't do
+// as they don't know their parents, and in the common case
+// of a scene which is built once and then drawn many times,
+// is just as effective.
+std::atomic<uint64_t> g_generation( 1 );
+
+std::atomic<size_t> g_renderedPrimitives( 0 );
+std::atomic<size_t> g_culledPrimitives( 0 );
+std::atomic<size_t> g_culledGroups( 0 );
+
+M44f glObjectToClip()
+{
+	M44f modelView;
+	M44f projection;
+	glGetFloatv( GL_MODELVIEW_MATRIX, modelView.getValue() );
+	glGetFloatv( GL_PROJECTION_MATRIX, projection.getValue() );
+	return modelView * projection;
+}
+
+// The object to clip matrix for the Group currently being rendered,
+// or nullptr if no enclosing Group has needed it. Reading the matrices
+// back from GL is expensive, so we only do it once at the root of a
+// culled hierarchy, and then concatenate Group transforms as we
+// descend.
+const M44f *g_objectToClip = nullptr;
+
+// Restores g_objectToClip on destruction, so that each Group
+// can set the matrix for its children.
+class ObjectToClipScope
+{
+
+	public :
+
+		ObjectToClipScope()
+			:	m_parent( g_objectToClip )
+		{
+		}
+
+		~ObjectToClipScope()
+		{
+			g_objectToClip = m_parent;
+		}
+
+		const M44f *parent() const
+		{
+			return m_parent;
+		}
+
+		void set( const M44f &objectToClip )
+		{
+			m_objectToClip = objectToClip;
+			g_objectToClip = &m_objectToClip;
+		}
+
+	private :
+
+		const M44f *m_parent;
+		M44f m_objectToClip;
+
+};
+
+// Returns true if the box lies entirely outside one of the
+// planes of the frustum. This is performed in homogeneous clip
+// space, where the frustum is defined by -w <= x, y, z <= w,
+// so it works for any projection and for corners lying
+// behind the camera.
+bool outsideFrustum( const Box3f &box, const M44f &objectToClip )
+{
+	if( box.isEmpty() || box.isInfinite() )
+	{
+		// Some Renderables don't provide a meaningful bound,
+		// so we must be conservative.
+		return false;
+	}
+
+	unsigned outside[6] = { 0, 0, 0, 0, 0, 0 };
+	for( int i = 0; i < 8; ++i )
+	{
+		const V3f corner(
+			i & 1 ? box.max.x : box.min.x,
+			i & 2 ? box.max.y : box.min.y,
+			i & 4 ? box.max.z : box.min.z
+		);
+
+		const float *m = objectToClip.getValue();
+		const float x = corner.x * m[0] + corner.y * m[4] + corner.z * m[8] + m[12];
+		const float y = corner.x * m[1] + corner.y * m[5] + corner.z * m[9] + m[13];
+		const float z = corner.x * m[2] + corner.y * m[6] + corner.z * m[10] + m[14];
+		const float w = corner.x * m[3] + corner.y * m[7] + corner.z * m[11] + m[15];
+
+		outside[0] += x < -w;
+		outside[1] += x > w;
+		outside[2] += y < -w;
+		outside[3] += y > w;
+		outside[4] += z < -w;
+		outside[5] += z > w;
+	}
+
+	for( int i = 0; i < 6; ++i )
+	{
+		if( outside[i] == 8 )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// StateComponents
+//////////////////////////////////////////////////////////////////////////
+
+namespace IECoreGL
+{
+
+IECOREGL_TYPEDSTATECOMPONENT_SPECIALISEANDINSTANTIATE( Group::FrustumCulling, GroupFrustumCullingTypeId, bool, false );
+
+} // namespace IECoreGL
+
+//////////////////////////////////////////////////////////////////////////
+// Group
+//////////////////////////////////////////////////////////////////////////
+
 IE_CORE_DEFINERUNTIMETYPED( Group );
 
 Group::Group()
-	:	m_state( new State( false ) ), m_transform( M44f() )
+	:	m_state( new State( false ) ), m_transform( M44f() ), m_numPrimitives( 0 ), m_cacheGeneration( 0 )
 {
 }
 
 Group::Group( const Group &other )
-	:	m_state( new State( *(other.m_state) ) ), m_transform( other.m_transform ), m_children( other.m_children )
+	:	m_state( new State( *(other.m_state) ) ), m_transform( other.m_transform ), m_children( other.m_children ),
+		m_numPrimitives( 0 ), m_cacheGeneration( 0 )
 {
 }
 
@@ -62,6 +197,7 @@ Group::~Group()
 void Group::setTransform( const Imath::M44f &matrix )
 {
 	m_transform = matrix;
+	g_generation++;
 }
 
 const Imath::M44f &Group::getTransform() const
@@ -109,9 +245,54 @@ void Group::render( State *currentState ) const
 
 	{
 		State::ScopedBinding scope( *m_state, *currentState );
-		for( ChildContainer::const_iterator it=m_children.begin(); it!=m_children.end(); it++ )
+		const bool culling = currentState->get<FrustumCulling>()->value() && !m_children.empty();
+
+		ObjectToClipScope objectToClipScope;
+		if( objectToClipScope.parent() )
+		{
+			if( haveTransform )
+			{
+				objectToClipScope.set( m_transform * *objectToClipScope.parent() );
+			}
+		}
+		else if( culling )
+		{
+			objectToClipScope.set( glObjectToClip() );
+		}
+
+		if( culling )
 		{
-			(*it)->render( currentState );
+			const M44f &clip = *g_objectToClip;
+			for( ChildContainer::const_iterator it=m_children.begin(); it!=m_children.end(); it++ )
+			{
+				const Group *group = IECore::runTimeCast<const Group>( it->get() );
+				if( outsideFrustum( (*it)->bound(), clip ) )
+				{
+					if( group )
+					{
+						g_culledGroups++;
+						g_culledPrimitives += group->numPrimitives();
+					}
+					else
+					{
+						g_culledPrimitives++;
+					}
+					continue;
+				}
+
+				(*it)->render( currentState );
+				if( !group )
+				{
+					g_renderedPrimitives++;
+				}
+			}
+		}
+		else
+		{
+			for( ChildContainer::const_iterator it=m_children.begin(); it!=m_children.end(); it++ )
+			{
+				(*it)->render( currentState );
+			}
 		}
 	}
 
@@ -123,27 +304,26 @@ void Group::render( State *currentState ) const
 
 Imath::Box3f Group::bound() const
 {
-	Box3f result;
-	for( ChildContainer::const_iterator it=children().begin(); it!=children().end(); it++ )
-	{
-		result.extendBy( (*it)->bound() );
-	}
-	return transform( result, m_transform );
+	updateCache();
+	return m_bound;
 }
 
 void Group::addChild( RenderablePtr child )
 {
 	m_children.push_back( child );
+	g_generation++;
 }
 
 void Group::removeChild( Renderable *child )
 {
 	m_children.remove( child );
+	g_generation++;
 }
 
 void Group::clearChildren()
 {
 	m_children.clear();
+	g_generation++;
 }
 
 const Group::ChildContainer &Group::children() const
@@ -156,3 +336,72 @@ Group::Mutex &Group::mutex() const
 	return m_mutex;
 }
 
+
+Group::Statistics Group::statistics()
+{
+	Statistics result;
+	result.renderedPrimitives = g_renderedPrimitives;
+	result.culledPrimitives = g_culledPrimitives;
+	result.culledGroups = g_culledGroups;
+	return result;
+}
+
+void Group::resetStatistics()
+{
+	g_renderedPrimitives = 0;
+	g_culledPrimitives = 0;
+	g_culledGroups = 0;
+}
+
+uint64_t Group::generation()
+{
+	return g_generation;
+}
+
+void Group::invalidateCaches()
+{
+	g_generation++;
+}
+
+void Group::updateCache() const
+{
+	const uint64_t generation = g_generation;
+	if( m_cacheGeneration == generation )
+	{
+		return;
+	}
+
+	Mutex::scoped_lock lock( m_mutex );
+	if( m_cacheGeneration == generation )
+	{
+		return;
+	}
+
+	Box3f bound;
+	size_t numPrimitives = 0;
+	for( ChildContainer::const_iterator it=m_children.begin(); it!=m_children.end(); it++ )
+	{
+		if( const Group *group = IECore::runTimeCast<const Group>( it->get() ) )
+		{
+			// Fills the child's cache, so that it can
+			// be used when culling the child itself.
+			bound.extendBy( group->bound() );
+			numPrimitives += group->numPrimitives();
+		}
+		else
+		{
+			bound.extendBy( (*it)->bound() );
+			numPrimitives++;
+		}
+	}
+
+	m_bound = transform( bound, m_transform );
+	m_numPrimitives = numPrimitives;
+	m_cacheGeneration = generation;
+}
+
+size_t Group::numPrimitives() const
+{
+	updateCache();
+	return m_numPrimitives;
+}
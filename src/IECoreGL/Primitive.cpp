@@ -153,6 +153,26 @@ const Shader::Setup *flatConstantShaderSetup( State *state, bool forIDRender )
 	return shaderSetup.get();
 }
 
+// Calls `f` once for each transform, with the transform concatenated
+// onto the current matrix, or just once if `transforms` is null.
+template<typename F>
+void forEachTransform( const std::vector<Imath::M44f> *transforms, F &&f )
+{
+	if( !transforms )
+	{
+		f();
+		return;
+	}
+
+	for( const auto &transform : *transforms )
+	{
+		glPushMatrix();
+		glMultMatrixf( transform.getValue() );
+		f();
+		glPopMatrix();
+	}
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -182,6 +202,16 @@ void Primitive::addPrimitiveVariable( const std::string &name, const IECoreScene
 }
 
 void Primitive::render( State *state ) const
+{
+	renderInternal( state, nullptr );
+}
+
+void Primitive::renderAt( State *state, const std::vector<Imath::M44f> &transforms ) const
+{
+	renderInternal( state, &transforms );
+}
+
+void Primitive::renderInternal( State *state, const std::vector<Imath::M44f> *transforms ) const
 {
 	const Selector *currentSelector = Selector::currentSelector();
 	if( currentSelector && !state->get<Primitive::Selectable>()->value() )
@@ -201,7 +231,7 @@ void Primitive::render( State *state ) const
 		Shader::Setup::ScopedBinding uniformBinding( *uniformSetup );
 		const Shader::Setup *primitiveSetup = shaderSetup( uniformSetup->shader(), state );
 		Shader::Setup::ScopedBinding primitiveBinding( *primitiveSetup );
-		render( state, Primitive::DrawSolid::staticTypeId() );
+		forEachTransform( transforms, [&] { render( state, Primitive::DrawSolid::staticTypeId() ); } );
 		return;
 	}
 
@@ -239,7 +269,7 @@ void Primitive::render( State *state ) const
 			}
 		}
 		// then we defer to the derived class to perform the draw call.
-		render( state, Primitive::DrawSolid::staticTypeId() );
+		forEachTransform( transforms, [&] { render( state, Primitive::DrawSolid::staticTypeId() ); } );
 	}
 
 	// then perform wireframe shading etc as requested
@@ -284,7 +314,7 @@ void Primitive::render( State *state ) const
 		{
 			glUniform3fv( csIndex, 1, state->get<WireframeColorStateComponent>()->value().getValue() );
 		}
-		render( state, Primitive::DrawWireframe::staticTypeId() );
+		forEachTransform( transforms, [&] { render( state, Primitive::DrawWireframe::staticTypeId() ); } );
 	}
 
 	// points
@@ -300,7 +330,7 @@ void Primitive::render( State *state ) const
 		{
 			glUniform3fv( csIndex, 1, state->get<PointColorStateComponent>()->value().getValue() );
 		}
-		render( state, Primitive::DrawPoints::staticTypeId() );
+		forEachTransform( transforms, [&] { render( state, Primitive::DrawPoints::staticTypeId() ); } );
 	}
 
 	// outline
@@ -316,7 +346,7 @@ void Primitive::render( State *state ) const
 		{
 			glUniform3fv( csIndex, 1, state->get<OutlineColorStateComponent>()->value().getValue() );
 		}
-		render( state, Primitive::DrawOutline::staticTypeId() );
+		forEachTransform( transforms, [&] { render( state, Primitive::DrawOutline::staticTypeId() ); } );
 	}
 
 	// bound
@@ -330,7 +360,7 @@ void Primitive::render( State *state ) const
 		{
 			glUniform3fv( csIndex, 1, state->get<BoundColorStateComponent>()->value().getValue() );
 		}
-		glDrawArrays( GL_LINES, 0, 24 );
+		forEachTransform( transforms, [] { glDrawArrays( GL_LINES, 0, 24 ); } );
 	}
 
 }
@@ -0,0 +1,83 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2019, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//
+//     * Neither the name of Image Engine Design nor the names of any
+//       other contributors to this software may be used to endorse or
+//       promote products derived from this software without specific prior
+//       written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "IECoreGL/PrimitiveInstancer.h"
+
+#include "IECoreGL/Group.h"
+#include "IECoreGL/Primitive.h"
+
+#include "OpenEXR/ImathBoxAlgo.h"
+
+using namespace IECoreGL;
+using namespace Imath;
+
+IE_CORE_DEFINERUNTIMETYPED( PrimitiveInstancer );
+
+PrimitiveInstancer::PrimitiveInstancer( ConstPrimitivePtr primitive )
+	:	m_primitive( primitive ), m_primitiveBound( primitive->bound() )
+{
+}
+
+PrimitiveInstancer::~PrimitiveInstancer()
+{
+}
+
+const Primitive *PrimitiveInstancer::primitive() const
+{
+	return m_primitive.get();
+}
+
+void PrimitiveInstancer::addInstance( const Imath::M44f &transform )
+{
+	m_transforms.push_back( transform );
+	m_bound.extendBy( Imath::transform( m_primitiveBound, transform ) );
+	// We may already have been added to a Group, whose cached
+	// bound will now be out of date.
+	Group::invalidateCaches();
+}
+
+const std::vector<Imath::M44f> &PrimitiveInstancer::transforms() const
+{
+	return m_transforms;
+}
+
+void PrimitiveInstancer::render( State *currentState ) const
+{
+	m_primitive->renderAt( currentState, m_transforms );
+}
+
+Imath::Box3f PrimitiveInstancer::bound() const
+{
+	return m_bound;
+}
@@ -79,7 +79,9 @@
 
 #include "OpenEXR/ImathBoxAlgo.h"
 
+#include "tbb/blocked_range.h"
 #include "tbb/mutex.h"
+#include "tbb/parallel_for.h"
 
 #include <stack>
 
@@ -184,18 +186,30 @@ struct IECoreGL::Renderer::MemberData
 
 	void addPrimitive( const IECoreScene::Primitive *corePrimitive )
 	{
-		ConstPrimitivePtr glPrimitive;
-		if( implementation->getState<AutomaticInstancingStateComponent>()->value() )
+		addPrimitive( convertPrimitive( corePrimitive, implementation->getState<AutomaticInstancingStateComponent>()->value() ) );
+	}
+
+	IECoreGL::ConstPrimitivePtr convertPrimitive( const IECoreScene::Primitive *corePrimitive, bool automaticInstancing )
+	{
+		if( automaticInstancing )
 		{
-			glPrimitive = IECore::runTimeCast<const Primitive>( cachedConverter->convert( corePrimitive ) );
+			return IECore::runTimeCast<const Primitive>( cachedConverter->convert( corePrimitive ) );
 		}
 		else
 		{
 			ToGLConverterPtr converter = ToGLConverter::create( corePrimitive, IECoreGL::Primitive::staticTypeId() );
-			glPrimitive = IECore::runTimeCast<const Primitive>( converter->convert() );
+			if( !converter )
+			{
+				throw IECore::Exception(
+					boost::str(
+						boost::format(
+							"Unable to create converter for Object of type \"%s\""
+						) % corePrimitive->typeName()
+					)
+				);
+			}
+			return IECore::runTimeCast<const Primitive>( converter->convert() );
 		}
-
-		addPrimitive( glPrimitive );
 	}
 
 	void addPrimitive( IECoreGL::ConstPrimitivePtr glPrimitive )
@@ -1385,6 +1399,7 @@ static const AttributeSetterMap *attributeSetters()
 		(*a)["gl:cullingBox"] = typedAttributeSetter<CullingBoxStateComponent>;
 		(*a)["gl:procedural:reentrant"] = typedAttributeSetter<ProceduralThreadingStateComponent>;
 		(*a)["gl:visibility:camera"] = typedAttributeSetter<CameraVisibilityStateComponent>;
+		(*a)["gl:frustumCulling"] = typedAttributeSetter<IECoreGL::Group::FrustumCulling>;
 		(*a)["gl:depthTest"] = typedAttributeSetter<DepthTestStateComponent>;
 		(*a)["gl:depthMask"] = typedAttributeSetter<DepthMaskStateComponent>;
 		(*a)["gl:alphaTest"] = typedAttributeSetter<AlphaTestStateComponent>;
@@ -1439,6 +1454,7 @@ static const AttributeGetterMap *attributeGetters()
 		(*a)["gl:cullingBox"] = typedAttributeGetter<CullingBoxStateComponent>;
 		(*a)["gl:procedural:reentrant"] = typedAttributeGetter<ProceduralThreadingStateComponent>;
 		(*a)["gl:visibility:camera"] = typedAttributeGetter<CameraVisibilityStateComponent>;
+		(*a)["gl:frustumCulling"] = typedAttributeGetter<IECoreGL::Group::FrustumCulling>;
 		(*a)["gl:depthTest"] = typedAttributeGetter<DepthTestStateComponent>;
 		(*a)["gl:depthMask"] = typedAttributeGetter<DepthMaskStateComponent>;
 		(*a)["gl:alphaTest"] = typedAttributeGetter<AlphaTestStateComponent>;
@@ -1792,6 +1808,90 @@ void IECoreGL::Renderer::geometry( const std::string &type, const IECore::Compou
 	msg( Msg::Warning, "Renderer::geometry", boost::format( "Geometry type \"%s\" not implemented." ) % type );
 }
 
+void IECoreGL::Renderer::primitives( const std::vector<IECoreScene::ConstPrimitivePtr> &primitives, const std::vector<Imath::M44f> &transforms )
+{
+	if( !transforms.empty() && transforms.size() != primitives.size() )
+	{
+		msg( Msg::Error, "Renderer::primitives", "Number of transforms does not match number of primitives." );
+		return;
+	}
+
+	// Culling and handedness flips depend on the transform of each
+	// primitive, so we leave those cases to the default implementation,
+	// which deals with the primitives one at a time.
+	bool batch =
+		m_data->options.mode == MemberData::Deferred && m_data->inWorld && !m_data->currentInstance &&
+		m_data->implementation->getState<CullingBoxStateComponent>()->value().isEmpty()
+	;
+	for( size_t i = 0, e = transforms.size(); batch && i < e; ++i )
+	{
+		batch = determinant( transforms[i] ) >= 0;
+	}
+
+	if( !batch )
+	{
+		IECoreScene::Renderer::primitives( primitives, transforms );
+		return;
+	}
+
+	// Convert in parallel. This is safe because deferred mode doesn't
+	// create any GL resources until the scene is rendered.
+	const bool automaticInstancing = m_data->implementation->getState<AutomaticInstancingStateComponent>()->value();
+	std::vector<IECoreGL::ConstPrimitivePtr> glPrimitives( primitives.size() );
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, primitives.size() ),
+		[&]( const tbb::blocked_range<size_t> &range ) {
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				try
+				{
+					glPrimitives[i] = m_data->convertPrimitive( primitives[i].get(), automaticInstancing );
+				}
+				catch( ... )
+				{
+					// Dealt with below.
+				}
+			}
+		},
+		taskGroupContext
+	);
+
+	// Batch everything that converted successfully.
+	std::vector<IECoreGL::ConstPrimitivePtr> batchPrimitives;
+	std::vector<Imath::M44f> batchTransforms;
+	std::vector<size_t> unconverted;
+	batchPrimitives.reserve( glPrimitives.size() );
+	for( size_t i = 0, e = glPrimitives.size(); i < e; ++i )
+	{
+		if( !glPrimitives[i] )
+		{
+			unconverted.push_back( i );
+			continue;
+		}
+		batchPrimitives.push_back( glPrimitives[i] );
+		if( !transforms.empty() )
+		{
+			batchTransforms.push_back( transforms[i] );
+		}
+	}
+
+	m_data->implementation->addPrimitives( batchPrimitives, batchTransforms );
+
+	// Anything else gets rendered individually, so that it can be dealt with
+	// by the primitive's own render() method, or report errors in the usual way.
+	for( size_t i : unconverted )
+	{
+		transformBegin();
+		if( !transforms.empty() )
+		{
+			concatTransform( transforms[i] );
+		}
+		primitives[i]->render( this );
+		transformEnd();
+	}
+}
+
 void IECoreGL::Renderer::procedural( IECoreScene::Renderer::ProceduralPtr proc )
 {
 	if ( m_data->currentInstance )
@@ -1881,6 +1981,31 @@ void IECoreGL::Renderer::instance( const std::string &name )
 	}
 }
 
+void IECoreGL::Renderer::instances( const std::string &name, const std::vector<Imath::M44f> &transforms )
+{
+	MemberData::InstanceMap::iterator it = m_data->instances.find( name );
+	if( it == m_data->instances.end() )
+	{
+		msg( Msg::Warning, "Renderer::instances", boost::format( "No instance named \"%s\" was found." ) % name );
+		return;
+	}
+
+	bool batch = m_data->options.mode == MemberData::Deferred && m_data->inWorld && !m_data->currentInstance;
+	for( size_t i = 0, e = transforms.size(); batch && i < e; ++i )
+	{
+		batch = determinant( transforms[i] ) >= 0;
+	}
+
+	if( batch )
+	{
+		m_data->implementation->addInstances( it->second, transforms );
+	}
+	else
+	{
+		IECoreScene::Renderer::instances( name, transforms );
+	}
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 // commands
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,9 @@
 
 #include "IECoreGL/private/RendererImplementation.h"
 
+#include "IECoreGL/Group.h"
+#include "IECoreGL/Primitive.h"
+
 using namespace IECoreGL;
 
 RendererImplementation::RendererImplementation()
@@ -43,3 +46,31 @@ RendererImplementation::RendererImplementation()
 RendererImplementation::~RendererImplementation()
 {
 }
+
+void RendererImplementation::addPrimitives( const std::vector<ConstPrimitivePtr> &primitives, const std::vector<Imath::M44f> &transforms )
+{
+	for( size_t i = 0, e = primitives.size(); i < e; ++i )
+	{
+		if( transforms.empty() )
+		{
+			addPrimitive( primitives[i] );
+			continue;
+		}
+
+		transformBegin();
+		concatTransform( transforms[i] );
+		addPrimitive( primitives[i] );
+		transformEnd();
+	}
+}
+
+void RendererImplementation::addInstances( IECoreGL::GroupPtr grp, const std::vector<Imath::M44f> &transforms )
+{
+	for( const auto &transform : transforms )
+	{
+		transformBegin();
+		concatTransform( transform );
+		addInstance( grp );
+		transformEnd();
+	}
+}
@@ -36,14 +36,268 @@
 
 #include "IECoreGL/Camera.h"
 #include "IECoreGL/Group.h"
+#include "IECoreGL/NameStateComponent.h"
+#include "IECoreGL/Primitive.h"
 #include "IECoreGL/Selector.h"
 #include "IECoreGL/ShaderStateComponent.h"
 #include "IECoreGL/State.h"
 
+#include "OpenEXR/ImathBoxAlgo.h"
+#include "OpenEXR/ImathFun.h"
+
+#include <algorithm>
+#include <map>
+
 using namespace IECoreGL;
 using namespace Imath;
 using namespace std;
 
+//////////////////////////////////////////////////////////////////////////
+// Scene::BoundingVolumeHierarchy
+//////////////////////////////////////////////////////////////////////////
+
+/// A hierarchy of the world space bounds of all the selectable
+/// primitives in a Scene, used to perform selection without
+/// rendering.
+class Scene::BoundingVolumeHierarchy : public IECore::RefCounted
+{
+
+	public :
+
+		BoundingVolumeHierarchy( const Group *root )
+			:	m_generation( Group::generation() )
+		{
+			const State *defaultState = State::defaultState();
+			gatherItems( root, M44f(), defaultState->get<NameStateComponent>()->glName(), defaultState->get<Primitive::Selectable>()->value() );
+
+			if( m_items.size() )
+			{
+				m_nodes.reserve( 2 * m_items.size() );
+				m_nodes.push_back( Node() );
+				build( 0, 0, m_items.size() );
+			}
+		}
+
+		uint64_t generation() const
+		{
+			return m_generation;
+		}
+
+		/// Appends hits for all items which overlap the region,
+		/// specified in NDC space as for Scene::select().
+		void select( const M44f &worldToClip, const Box2f &region, std::vector<HitRecord> &hits ) const
+		{
+			if( m_nodes.empty() )
+			{
+				return;
+			}
+
+			// Convert to the -1 to 1 range, remembering that
+			// NDC has y pointing down.
+			const Box2f clipRegion(
+				V2f( region.min.x * 2.0f - 1.0f, 1.0f - region.max.y * 2.0f ),
+				V2f( region.max.x * 2.0f - 1.0f, 1.0f - region.min.y * 2.0f )
+			);
+
+			std::map<GLuint, HitRecord> namedHits;
+			std::vector<size_t> stack;
+			stack.push_back( 0 );
+			while( stack.size() )
+			{
+				const Node &node = m_nodes[stack.back()];
+				stack.pop_back();
+
+				float depthMin, depthMax;
+				if( !overlaps( node.bound, worldToClip, clipRegion, depthMin, depthMax ) )
+				{
+					continue;
+				}
+
+				if( node.numItems )
+				{
+					for( size_t i = node.index, e = node.index + node.numItems; i < e; ++i )
+					{
+						if( !overlaps( m_items[i].bound, worldToClip, clipRegion, depthMin, depthMax ) )
+						{
+							continue;
+						}
+
+						std::map<GLuint, HitRecord>::iterator it = namedHits.find( m_items[i].name );
+						if( it == namedHits.end() )
+						{
+							namedHits.insert( std::make_pair( m_items[i].name, HitRecord( depthMin, depthMax, m_items[i].name ) ) );
+						}
+						else
+						{
+							it->second.depthMin = std::min( it->second.depthMin, depthMin );
+							it->second.depthMax = std::max( it->second.depthMax, depthMax );
+						}
+					}
+				}
+				else
+				{
+					stack.push_back( node.index );
+					stack.push_back( node.index + 1 );
+				}
+			}
+
+			for( std::map<GLuint, HitRecord>::const_iterator it = namedHits.begin(); it != namedHits.end(); ++it )
+			{
+				hits.push_back( it->second );
+			}
+		}
+
+	private :
+
+		struct Item
+		{
+			Box3f bound;
+			GLuint name;
+		};
+
+		// Leaf nodes reference numItems items starting at index.
+		// Interior nodes have numItems == 0 and reference two
+		// adjacent child nodes starting at index.
+		struct Node
+		{
+			Box3f bound;
+			size_t index;
+			size_t numItems;
+		};
+
+		void gatherItems( const Group *group, const M44f &parentTransform, GLuint name, bool selectable )
+		{
+			const M44f transform = group->getTransform() * parentTransform;
+			if( const State *state = group->getState() )
+			{
+				if( const NameStateComponent *n = state->get<NameStateComponent>() )
+				{
+					name = n->glName();
+				}
+				if( const Primitive::Selectable *s = state->get<Primitive::Selectable>() )
+				{
+					selectable = s->value();
+				}
+			}
+
+			for( Group::ChildContainer::const_iterator it = group->children().begin(), eIt = group->children().end(); it != eIt; ++it )
+			{
+				if( const Group *childGroup = IECore::runTimeCast<const Group>( it->get() ) )
+				{
+					gatherItems( childGroup, transform, name, selectable );
+				}
+				else if( selectable )
+				{
+					const Box3f bound = (*it)->bound();
+					if( bound.isEmpty() )
+					{
+						continue;
+					}
+					Item item;
+					item.bound = Imath::transform( bound, transform );
+					item.name = name;
+					m_items.push_back( item );
+				}
+			}
+		}
+
+		void build( size_t nodeIndex, size_t begin, size_t end )
+		{
+			Box3f bound;
+			Box3f centroidBound;
+			for( size_t i = begin; i < end; ++i )
+			{
+				bound.extendBy( m_items[i].bound );
+				centroidBound.extendBy( m_items[i].bound.center() );
+			}
+			m_nodes[nodeIndex].bound = bound;
+
+			const size_t maxLeafItems = 4;
+			if( end - begin <= maxLeafItems || centroidBound.size() == V3f( 0 ) )
+			{
+				m_nodes[nodeIndex].index = begin;
+				m_nodes[nodeIndex].numItems = end - begin;
+				return;
+			}
+
+			// Split at the median along the longest axis.
+			const int axis = centroidBound.majorAxis();
+			const size_t middle = begin + ( end - begin ) / 2;
+			std::nth_element(
+				m_items.begin() + begin, m_items.begin() + middle, m_items.begin() + end,
+				[axis]( const Item &a, const Item &b ) {
+					return a.bound.min[axis] + a.bound.max[axis] < b.bound.min[axis] + b.bound.max[axis];
+				}
+			);
+
+			const size_t childIndex = m_nodes.size();
+			m_nodes[nodeIndex].index = childIndex;
+			m_nodes[nodeIndex].numItems = 0;
+			m_nodes.push_back( Node() );
+			m_nodes.push_back( Node() );
+			build( childIndex, begin, middle );
+			build( childIndex + 1, middle, end );
+		}
+
+		// Returns true if the world space box may overlap the region,
+		// specified in the -1 to 1 range of clip space. The test is
+		// performed in homogeneous clip space, so that it is valid for
+		// any projection and for corners lying behind the camera. If
+		// true is returned then depthMin and depthMax contain the range
+		// of depths covered by the box, normalised to the 0-1 range
+		// between the clipping planes.
+		static bool overlaps( const Box3f &box, const M44f &worldToClip, const Box2f &region, float &depthMin, float &depthMax )
+		{
+			unsigned outside[6] = { 0, 0, 0, 0, 0, 0 };
+			depthMin = 1.0f;
+			depthMax = 0.0f;
+			for( int i = 0; i < 8; ++i )
+			{
+				const V3f corner(
+					i & 1 ? box.max.x : box.min.x,
+					i & 2 ? box.max.y : box.min.y,
+					i & 4 ? box.max.z : box.min.z
+				);
+
+				const float *m = worldToClip.getValue();
+				const float x = corner.x * m[0] + corner.y * m[4] + corner.z * m[8] + m[12];
+				const float y = corner.x * m[1] + corner.y * m[5] + corner.z * m[9] + m[13];
+				const float z = corner.x * m[2] + corner.y * m[6] + corner.z * m[10] + m[14];
+				const float w = corner.x * m[3] + corner.y * m[7] + corner.z * m[11] + m[15];
+
+				outside[0] += x < region.min.x * w;
+				outside[1] += x > region.max.x * w;
+				outside[2] += y < region.min.y * w;
+				outside[3] += y > region.max.y * w;
+				outside[4] += z < -w;
+				outside[5] += z > w;
+
+				const float depth = w > 0.0f ? clamp( ( z / w + 1.0f ) * 0.5f, 0.0f, 1.0f ) : 0.0f;
+				depthMin = std::min( depthMin, depth );
+				depthMax = std::max( depthMax, depth );
+			}
+
+			for( int i = 0; i < 6; ++i )
+			{
+				if( outside[i] == 8 )
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		uint64_t m_generation;
+		std::vector<Item> m_items;
+		std::vector<Node> m_nodes;
+
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Scene
+//////////////////////////////////////////////////////////////////////////
+
 IE_CORE_DEFINERUNTIMETYPED( Scene );
 
 Scene::Scene()
@@ -92,6 +346,22 @@ size_t Scene::select( Selector::Mode mode, const Imath::Box2f &region, std::vect
 		m_camera->render( const_cast<State *>( State::defaultState() ) );
 	}
 
+	if( mode == Selector::Bound )
+	{
+		if( !m_boundingVolumeHierarchy || m_boundingVolumeHierarchy->generation() != Group::generation() )
+		{
+			m_boundingVolumeHierarchy = new BoundingVolumeHierarchy( root().get() );
+		}
+
+		M44f modelView;
+		M44f projection;
+		glGetFloatv( GL_MODELVIEW_MATRIX, modelView.getValue() );
+		glGetFloatv( GL_PROJECTION_MATRIX, projection.getValue() );
+
+		m_boundingVolumeHierarchy->select( modelView * projection, region, hits );
+		return hits.size();
+	}
+
 	Selector selector( region, mode, hits );
 
 	State::bindBaseState();
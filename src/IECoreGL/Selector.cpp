@@ -77,6 +77,11 @@ class Selector::Implementation : public IECore::RefCounted
 			// preexisting error.
 			IECoreGL::Exception::throwIfError();
 
+			if( m_mode == Bound )
+			{
+				throw( IECore::Exception( "Selector::Bound mode is only supported by Scene::select()" ) );
+			}
+
 			if( g_currentSelector )
 			{
 				throw( IECore::Exception( "Another Selector is already active" ) );
@@ -110,6 +110,17 @@ void TextPrimitive::render( State *currentState ) const
 	}
 }
 
+void TextPrimitive::renderAt( State *currentState, const std::vector<Imath::M44f> &transforms ) const
+{
+	for( const auto &transform : transforms )
+	{
+		glPushMatrix();
+		glMultMatrixf( transform.getValue() );
+		render( currentState );
+		glPopMatrix();
+	}
+}
+
 void TextPrimitive::renderInstances( size_t numInstances ) const
 {
 	// should never get here, because we override the master render()
@@ -35,6 +35,7 @@
 #include "IECoreGL/ToGLStateConverter.h"
 
 #include "IECoreGL/CurvesPrimitive.h"
+#include "IECoreGL/Group.h"
 #include "IECoreGL/PointsPrimitive.h"
 #include "IECoreGL/Primitive.h"
 #include "IECoreGL/ShaderLoader.h"
@@ -171,6 +172,7 @@ const AttributeToStateMap &attributeToStateMap()
 		m["gl:smoothing:points"] = attributeToTypedState<PointSmoothingStateComponent>;
 		m["gl:smoothing:lines"] = attributeToTypedState<LineSmoothingStateComponent>;
 		m["gl:smoothing:polygons"] = attributeToTypedState<PolygonSmoothingStateComponent>;
+		m["gl:frustumCulling"] = attributeToTypedState<IECoreGL::Group::FrustumCulling>;
 		m["gl:surface"] = attributeToShaderState;
 	}
 	return m;
@@ -37,6 +37,7 @@
 #include "IECoreGL/Group.h"
 #include "IECoreGL/State.h"
 #include "IECoreGL/bindings/SceneBinding.h"
+#include "IECoreGL/bindings/TypedStateComponentBinding.inl"
 
 #include "IECorePython/RunTimeTypedBinding.h"
 
@@ -83,7 +84,7 @@ list children( const Group &g )
 
 void bindGroup()
 {
-	IECorePython::RunTimeTypedClass<Group>()
+	scope s = IECorePython::RunTimeTypedClass<Group>()
 		.def( init<>() )
 		.def( "setTransform", &Group::setTransform )
 		.def( "getTransform", &Group::getTransform, return_value_policy<copy_const_reference>() )
@@ -94,7 +95,17 @@ void bindGroup()
 		.def( "clearChildren", &clearChildren )
 		.def( "bound", &bound )
 		.def( "children", &children, "Returns a list referencing the children of the group - modifying the list has no effect on the Group." )
+		.def( "statistics", &Group::statistics ).staticmethod( "statistics" )
+		.def( "resetStatistics", &Group::resetStatistics ).staticmethod( "resetStatistics" )
 	;
+
+	class_<Group::Statistics>( "Statistics", no_init )
+		.def_readonly( "renderedPrimitives", &Group::Statistics::renderedPrimitives )
+		.def_readonly( "culledPrimitives", &Group::Statistics::culledPrimitives )
+		.def_readonly( "culledGroups", &Group::Statistics::culledGroups )
+	;
+
+	bindTypedStateComponent<Group::FrustumCulling>( "FrustumCulling" );
 }
 
 }
@@ -54,6 +54,7 @@
 #include "IECoreGL/bindings/NameStateComponentBinding.h"
 #include "IECoreGL/bindings/PointsPrimitiveBinding.h"
 #include "IECoreGL/bindings/PrimitiveBinding.h"
+#include "IECoreGL/bindings/PrimitiveInstancerBinding.h"
 #include "IECoreGL/bindings/RenderableBinding.h"
 #include "IECoreGL/bindings/RendererBinding.h"
 #include "IECoreGL/bindings/SceneBinding.h"
@@ -116,6 +117,7 @@ BOOST_PYTHON_MODULE( _IECoreGL )
 	bindShaderStateComponent();
 	bindCurvesPrimitive();
 	bindToGLStateConverter();
+	bindPrimitiveInstancer();
 
 #ifdef IECORE_WITH_FREETYPE
 
@@ -0,0 +1,79 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2019, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//
+//     * Neither the name of Image Engine Design nor the names of any
+//       other contributors to this software may be used to endorse or
+//       promote products derived from this software without specific prior
+//       written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "boost/python.hpp"
+
+#include "IECoreGL/bindings/PrimitiveInstancerBinding.h"
+
+#include "IECoreGL/Primitive.h"
+#include "IECoreGL/PrimitiveInstancer.h"
+
+#include "IECorePython/RunTimeTypedBinding.h"
+
+using namespace boost::python;
+
+namespace
+{
+
+IECoreGL::PrimitivePtr primitive( const IECoreGL::PrimitiveInstancer &instancer )
+{
+	return const_cast<IECoreGL::Primitive *>( instancer.primitive() );
+}
+
+list transforms( const IECoreGL::PrimitiveInstancer &instancer )
+{
+	list result;
+	for( const auto &transform : instancer.transforms() )
+	{
+		result.append( transform );
+	}
+	return result;
+}
+
+} // namespace
+
+namespace IECoreGL
+{
+
+void bindPrimitiveInstancer()
+{
+	IECorePython::RunTimeTypedClass<PrimitiveInstancer>()
+		.def( init<ConstPrimitivePtr>() )
+		.def( "primitive", &primitive )
+		.def( "addInstance", &PrimitiveInstancer::addInstance )
+		.def( "transforms", &transforms )
+	;
+}
+
+} // namespace IECoreGL
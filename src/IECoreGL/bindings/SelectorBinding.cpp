@@ -105,6 +105,7 @@ void bindSelector()
 		.value( "GLSelect", Selector::GLSelect )
 		.value( "OcclusionQuery", Selector::OcclusionQuery )
 		.value( "IDRender", Selector::IDRender )
+		.value( "Bound", Selector::Bound )
 	;
 }
 
@@ -44,6 +44,9 @@
 #include "IECore/Math.h"
 #include "IECore/NullObject.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
 using namespace std;
 using namespace boost;
 using namespace Imath;
@@ -108,13 +111,13 @@ const IntParameter * EnvMapSampler::subdivisionDepthParameter() const
 
 ObjectPtr EnvMapSampler::doOperation( const CompoundObject * operands )
 {
-	ImagePrimitivePtr image = static_cast<ImagePrimitive *>( imageParameter()->getValue() )->copy();
-	Box2i dataWindow = image->getDataWindow();
+	const ImagePrimitive *inputImage = static_cast<const ImagePrimitive *>( imageParameter()->getValue() );
+	Box2i dataWindow = inputImage->getDataWindow();
 
 	// find the rgb channels
-	ConstFloatVectorDataPtr redData = image->getChannel<float>( "R" );
-	ConstFloatVectorDataPtr greenData = image->getChannel<float>( "G" );
-	ConstFloatVectorDataPtr blueData = image->getChannel<float>( "B" );
+	ConstFloatVectorDataPtr redData = inputImage->getChannel<float>( "R" );
+	ConstFloatVectorDataPtr greenData = inputImage->getChannel<float>( "G" );
+	ConstFloatVectorDataPtr blueData = inputImage->getChannel<float>( "B" );
 	if( !(redData && greenData && blueData) )
 	{
 		throw Exception( "Image does not contain valid RGB float channels." );
@@ -123,7 +126,14 @@ ObjectPtr EnvMapSampler::doOperation( const CompoundObject * operands )
 	const vector<float> &green = greenData->readable();
 	const vector<float> &blue = blueData->readable();
 
-	// get a luminance channel
+	// get a luminance channel. we only need the colour channels for this,
+	// so rather than copy the whole input image we make a new image which
+	// shares them.
+	ImagePrimitivePtr image = new ImagePrimitive( dataWindow, inputImage->getDisplayWindow() );
+	image->channels["R"] = boost::const_pointer_cast<FloatVectorData>( redData );
+	image->channels["G"] = boost::const_pointer_cast<FloatVectorData>( greenData );
+	image->channels["B"] = boost::const_pointer_cast<FloatVectorData>( blueData );
+
 	LuminanceOpPtr luminanceOp = new LuminanceOp();
 	luminanceOp->inputParameter()->setValue( image );
 	luminanceOp->copyParameter()->getTypedValue() = false;
@@ -147,28 +157,44 @@ ObjectPtr EnvMapSampler::doOperation( const CompoundObject * operands )
 	float radiansPerPixel = M_PI / (dataWindow.size().y + 1);
 	float angleAtTop = ( M_PI - radiansPerPixel ) / 2.0f;
 
-	for( unsigned i=0; i<centroids.size(); i++ )
-	{
-		const Box2i &area = areas[i];
-		Color3f color( 0 );
-		for( int y=area.min.y; y<=area.max.y; y++ )
+	// sum the colours within each area. the areas partition the image,
+	// so this visits each pixel just once, and we can sum them in parallel.
+	colors.resize( areas.size() );
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, areas.size(), 1 ),
+		[&]( const tbb::blocked_range<size_t> &range )
 		{
-			int yRel = y - dataWindow.min.y;
-
-			float angle = angleAtTop - yRel * radiansPerPixel;
-			float weight = cosf( angle );
-			int index = (area.min.x - dataWindow.min.x) + (dataWindow.size().x + 1 ) * yRel;
-			for( int x=area.min.x; x<=area.max.x; x++ )
+			for( size_t i = range.begin(); i != range.end(); ++i )
 			{
-				color[0] += weight * red[index];
-				color[1] += weight * green[index];
-				color[2] += weight * blue[index];
-				index++;
+				const Box2i &area = areas[i];
+				Color3<double> color( 0 );
+				for( int y=area.min.y; y<=area.max.y; y++ )
+				{
+					int yRel = y - dataWindow.min.y;
+
+					float angle = angleAtTop - yRel * radiansPerPixel;
+					float weight = cosf( angle );
+					Color3<double> rowColor( 0 );
+					size_t index = (area.min.x - dataWindow.min.x) + (size_t)(dataWindow.size().x + 1 ) * yRel;
+					for( int x=area.min.x; x<=area.max.x; x++ )
+					{
+						rowColor[0] += red[index];
+						rowColor[1] += green[index];
+						rowColor[2] += blue[index];
+						index++;
+					}
+					color += rowColor * weight;
+				}
+				color /= red.size();
+				colors[i] = Color3f( color[0], color[1], color[2] );
 			}
-		}
-		color /= red.size();
-		colors.push_back( color );
+		},
+		taskGroupContext
+	);
 
+	for( unsigned i=0; i<centroids.size(); i++ )
+	{
 		float phi = angleAtTop - (centroids[i].y - dataWindow.min.y) * radiansPerPixel;
 
 		V3f direction;
@@ -43,6 +43,7 @@
 #include "IECore/FileNameParameter.h"
 #include "IECore/NullObject.h"
 #include "IECore/ObjectParameter.h"
+#include "IECore/TypedParameter.h"
 
 #include "OpenImageIO/imagecache.h"
 #include "OpenImageIO/imageio.h"
@@ -50,6 +51,11 @@
 
 #include "boost/tokenizer.hpp"
 
+#include "tbb/blocked_range2d.h"
+#include "tbb/parallel_for.h"
+
+#include <algorithm>
+
 OIIO_NAMESPACE_USING
 
 using namespace std;
@@ -60,6 +66,15 @@ using namespace IECoreImage;
 
 IE_CORE_DEFINERUNTIMETYPED( ImageReader );
 
+namespace
+{
+
+// The largest number of unrequested channels we'll read and discard in
+// order to read two requested channels with a single call to get_pixels().
+const size_t g_maxUnrequestedChannels = 2;
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 // ImageReader::Implementation
 ////////////////////////////////////////////////////////////////////////////////
@@ -69,7 +84,7 @@ class ImageReader::Implementation
 
 	public :
 
-		Implementation( const ImageReader *reader ) : m_reader( reader ), m_cache( nullptr, &destroyImageCache )
+		Implementation( const ImageReader *reader ) : m_reader( reader ), m_cache( nullptr ), m_privateCache( nullptr, &destroyImageCache )
 		{
 		}
 
@@ -78,6 +93,14 @@ class ImageReader::Implementation
 			m_reader = nullptr;
 		}
 
+		static ImageCache *sharedCache()
+		{
+			// Deliberately leaked, so that it remains valid for readers
+			// destroyed during static destruction.
+			static ImageCache *g_cache = ImageCache::create( /* shared */ false );
+			return g_cache;
+		}
+
 		static bool canRead( const std::string &filename )
 		{
 			bool result = false;
@@ -217,19 +240,34 @@ class ImageReader::Implementation
 			members["dataWindow"] = new Box2iData( dataWindow() );
 		}
 
-		DataPtr readChannel( const std::string &name, bool raw )
+		std::vector<DataPtr> readChannels( const std::vector<std::string> &names, bool raw )
 		{
 			open( /* throwOnFailure */ true );
 
 			const ImageSpec *spec = m_cache->imagespec( m_inputFileName );
 
-			const auto channelIt = find( spec->channelnames.begin(), spec->channelnames.end(), name );
-			if( channelIt == spec->channelnames.end() )
+			std::vector<size_t> channelIndices;
+			channelIndices.reserve( names.size() );
+			for( const auto &name : names )
+			{
+				const auto channelIt = find( spec->channelnames.begin(), spec->channelnames.end(), name );
+				if( channelIt == spec->channelnames.end() )
+				{
+					throw InvalidArgumentException( "Image Reader : Non-existent image channel \"" + name + "\" requested." );
+				}
+				channelIndices.push_back( channelIt - spec->channelnames.begin() );
+			}
+
+			if( channelIndices.empty() )
 			{
-				throw InvalidArgumentException( "Image Reader : Non-existent image channel \"" + name + "\" requested." );
+				return std::vector<DataPtr>();
 			}
 
-			size_t channelIndex = channelIt - spec->channelnames.begin();
+			Box2i window = m_reader->m_dataWindowParameter->getTypedValue();
+			if( window.isEmpty() )
+			{
+				window = dataWindow();
+			}
 
 			if( raw )
 			{
@@ -237,39 +275,39 @@ class ImageReader::Implementation
 				{
 					case TypeDesc::UCHAR :
 					{
-						return readTypedChannel<unsigned char>( channelIndex, spec->format );
+						return readTypedChannels<unsigned char>( channelIndices, window, spec->format );
 					}
 					case TypeDesc::CHAR :
 					{
-						return readTypedChannel<char>( channelIndex, spec->format );
+						return readTypedChannels<char>( channelIndices, window, spec->format );
 					}
 					case TypeDesc::USHORT :
 					{
-						return readTypedChannel<unsigned short>( channelIndex, spec->format );
+						return readTypedChannels<unsigned short>( channelIndices, window, spec->format );
 					}
 					case TypeDesc::SHORT :
 					{
-						return readTypedChannel<short>( channelIndex, spec->format );
+						return readTypedChannels<short>( channelIndices, window, spec->format );
 					}
 					case TypeDesc::UINT :
 					{
-						return readTypedChannel<unsigned int>( channelIndex, spec->format );
+						return readTypedChannels<unsigned int>( channelIndices, window, spec->format );
 					}
 					case TypeDesc::INT :
 					{
-						return readTypedChannel<int>( channelIndex, spec->format );
+						return readTypedChannels<int>( channelIndices, window, spec->format );
 					}
 					case TypeDesc::HALF :
 					{
-						return readTypedChannel<half>( channelIndex, spec->format );
+						return readTypedChannels<half>( channelIndices, window, spec->format );
 					}
 					case TypeDesc::FLOAT :
 					{
-						return readTypedChannel<float>( channelIndex, spec->format );
+						return readTypedChannels<float>( channelIndices, window, spec->format );
 					}
 					case TypeDesc::DOUBLE :
 					{
-						return readTypedChannel<double>( channelIndex, spec->format );
+						return readTypedChannels<double>( channelIndices, window, spec->format );
 					}
 					default :
 					{
@@ -279,57 +317,161 @@ class ImageReader::Implementation
 			}
 			else
 			{
-				DataPtr data = readTypedChannel<float>( channelIndex, TypeDesc::FLOAT );
-				if( (int)channelIndex != spec->alpha_channel && (int)channelIndex != spec->z_channel )
+				std::vector<DataPtr> result = readTypedChannels<float>( channelIndices, window, TypeDesc::FLOAT );
+
+				const char *fileFormat = nullptr;
+				m_cache->get_image_info(
+					m_inputFileName,
+					0, 0, // subimage, miplevel
+					ustring( "fileformat" ),
+					TypeDesc::TypeString, &fileFormat
+				);
+
+				const std::string linearColorSpace = OpenImageIOAlgo::colorSpace( "", *spec );
+				const std::string currentColorSpace = OpenImageIOAlgo::colorSpace( fileFormat, *spec );
+				if( currentColorSpace != linearColorSpace )
 				{
-					const char *fileFormat = nullptr;
-					m_cache->get_image_info(
-						m_inputFileName,
-						0, 0, // subimage, miplevel
-						ustring( "fileformat" ),
-						TypeDesc::TypeString, &fileFormat
+					tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+					tbb::parallel_for(
+						tbb::blocked_range<size_t>( 0, channelIndices.size(), 1 ),
+						[&]( const tbb::blocked_range<size_t> &range )
+						{
+							for( size_t i = range.begin(); i != range.end(); ++i )
+							{
+								const int channelIndex = channelIndices[i];
+								if( channelIndex != spec->alpha_channel && channelIndex != spec->z_channel )
+								{
+									ColorAlgo::transformChannel( result[i].get(), currentColorSpace, linearColorSpace );
+								}
+							}
+						},
+						taskGroupContext
 					);
-
-					std::string linearColorSpace = OpenImageIOAlgo::colorSpace( "", *spec );
-					std::string currentColorSpace = OpenImageIOAlgo::colorSpace( fileFormat, *spec );
-					ColorAlgo::transformChannel( data.get(), currentColorSpace, linearColorSpace );
 				}
 
-				return data;
+				return result;
 			}
 		}
 
 	private :
 
+		// Reads the specified channels within `window`. Adjacent channels are
+		// read together with a single call to get_pixels() and then
+		// de-interleaved in parallel, but channels separated by more than
+		// `g_maxUnrequestedChannels` are read separately, so that we don't
+		// load unrelated layers from multi-layer files.
 		template<class T>
-		DataPtr readTypedChannel( size_t channelIndex, TypeDesc dataType )
+		std::vector<DataPtr> readTypedChannels( const std::vector<size_t> &channelIndices, const Box2i &window, TypeDesc dataType )
 		{
 			typedef TypedData<vector<T> > DataType;
-			typename DataType::Ptr data = new DataType;
 
-			bool status;
+			const V2i size = window.size() + V2i( 1 );
+			const size_t numPixels = size.x * size.y;
 
-			const ImageSpec *spec = m_cache->imagespec( m_inputFileName );
+			std::vector<DataPtr> result;
+			std::vector<T *> channels;
+			result.reserve( channelIndices.size() );
+			channels.reserve( channelIndices.size() );
+			for( size_t i = 0; i < channelIndices.size(); ++i )
+			{
+				typename DataType::Ptr data = new DataType;
+				data->writable().resize( numPixels );
+				channels.push_back( data->writable().data() );
+				result.push_back( data );
+			}
 
-			data->writable().resize( spec->width * spec->height );
+			std::vector<size_t> sortedIndices( channelIndices );
+			std::sort( sortedIndices.begin(), sortedIndices.end() );
+			sortedIndices.erase( std::unique( sortedIndices.begin(), sortedIndices.end() ), sortedIndices.end() );
+
+			for( size_t runBegin = 0; runBegin < sortedIndices.size(); )
+			{
+				size_t runEnd = runBegin + 1;
+				while( runEnd < sortedIndices.size() && sortedIndices[runEnd] - sortedIndices[runEnd-1] <= g_maxUnrequestedChannels + 1 )
+				{
+					++runEnd;
+				}
+				readTypedChannelRun<T>( sortedIndices[runBegin], sortedIndices[runEnd-1] + 1, channelIndices, channels, numPixels, window, dataType );
+				runBegin = runEnd;
+			}
+
+			return result;
+		}
 
-			status = m_cache->get_pixels(
+		// Reads the file channels from `channelBegin` to `channelEnd` and
+		// distributes them to every element of `channels` whose index falls
+		// within that range. Repeated indices each receive a copy.
+		template<class T>
+		void readTypedChannelRun( size_t channelBegin, size_t channelEnd, const std::vector<size_t> &channelIndices, const std::vector<T *> &channels, size_t numPixels, const Box2i &window, TypeDesc dataType )
+		{
+			const size_t numChannels = channelEnd - channelBegin;
+
+			std::vector<size_t> outputs;
+			for( size_t i = 0; i < channelIndices.size(); ++i )
+			{
+				if( channelIndices[i] >= channelBegin && channelIndices[i] < channelEnd )
+				{
+					outputs.push_back( i );
+				}
+			}
+
+			// When only one channel is needed we can read straight into the
+			// first output, otherwise we read into an interleaved buffer.
+			std::vector<T> interleaved;
+			T *buffer = channels[outputs[0]];
+			if( numChannels > 1 )
+			{
+				interleaved.resize( numPixels * numChannels );
+				buffer = interleaved.data();
+			}
+
+			const bool status = m_cache->get_pixels(
 				m_inputFileName,
 				0, 0, // subimage, miplevel
-				spec->x, spec->width + spec->x,
-				spec->y, spec->height + spec->y,
+				window.min.x, window.max.x + 1,
+				window.min.y, window.max.y + 1,
 				0, 1, // z begin, z end
-				channelIndex, channelIndex + 1,
+				channelBegin, channelEnd,
 				/* format */ dataType,
-				/* data */ &( data->writable()[0] )
+				/* data */ buffer
 			);
 
 			if( !status )
 			{
-				throw IOException( string( "ImageReader : Failed to read channel \"" ) + spec->channelnames[channelIndex] + "\". " + m_cache->geterror() );
+				const ImageSpec *spec = m_cache->imagespec( m_inputFileName );
+				std::string channelNames;
+				for( auto i : outputs )
+				{
+					channelNames += ( channelNames.empty() ? "\"" : ", \"" ) + spec->channelnames[channelIndices[i]] + "\"";
+				}
+				throw IOException( string( "ImageReader : Failed to read channels " ) + channelNames + ". " + m_cache->geterror() );
 			}
 
-			return data;
+			if( outputs.size() > 1 || numChannels > 1 )
+			{
+				tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+				tbb::parallel_for(
+					tbb::blocked_range2d<size_t>( 0, outputs.size(), 1, 0, numPixels, 4096 ),
+					[&]( const tbb::blocked_range2d<size_t> &range )
+					{
+						for( size_t o = range.rows().begin(); o != range.rows().end(); ++o )
+						{
+							const size_t i = outputs[o];
+							T *out = channels[i];
+							if( out == buffer )
+							{
+								continue;
+							}
+							const T *in = buffer + channelIndices[i] - channelBegin + range.cols().begin() * numChannels;
+							for( size_t p = range.cols().begin(); p != range.cols().end(); ++p, in += numChannels )
+							{
+								out[p] = *in;
+							}
+						}
+					},
+					taskGroupContext
+				);
+			}
 		}
 
 		void addMetadata( const std::string &name, DataPtr data, CompoundData *metadata )
@@ -357,14 +499,24 @@ class ImageReader::Implementation
 		// Exception is thrown rather than false being returned.
 		bool open( bool throwOnFailure = false )
 		{
-			if( m_cache && m_reader->fileName() == m_inputFileName )
+			const bool useSharedCache = m_reader->m_sharedCacheParameter->getTypedValue();
+			if( m_cache && m_reader->fileName() == m_inputFileName && useSharedCache == ( m_cache == sharedCache() ) )
 			{
 				// we already opened the right file successfully
 				return true;
 			}
 
 			m_inputFileName = "";
-			m_cache.reset( ImageCache::create( /* shared */ false ) );
+			if( useSharedCache )
+			{
+				m_cache = sharedCache();
+				m_privateCache.reset();
+			}
+			else
+			{
+				m_privateCache.reset( ImageCache::create( /* shared */ false ) );
+				m_cache = m_privateCache.get();
+			}
 
 			// a non-null spec indicates the image was opened successfully
 			if( m_cache->imagespec( ustring( m_reader->fileName() ) ) )
@@ -389,7 +541,9 @@ class ImageReader::Implementation
 		}
 
 		const ImageReader *m_reader;
-		std::unique_ptr<ImageCache, decltype(&destroyImageCache) > m_cache;
+		// Either m_privateCache or sharedCache().
+		ImageCache *m_cache;
+		std::unique_ptr<ImageCache, decltype(&destroyImageCache) > m_privateCache;
 		ustring m_inputFileName;
 
 };
@@ -418,8 +572,25 @@ ImageReader::ImageReader() :
 		false
 	);
 
+	m_dataWindowParameter = new Box2iParameter(
+		"dataWindow",
+		"The region of pixels to load. If empty (the default value) then the whole data window "
+		"is loaded. Pixels outside the data window stored in the file are filled with zero.",
+		Box2i()
+	);
+
+	m_sharedCacheParameter = new BoolParameter(
+		"sharedCache",
+		"Specifies if the file is read through an image cache shared by all readers in the process, "
+		"rather than one private to this reader. The shared cache reuses decoded pixels between readers, "
+		"but does not notice when files are modified on disk.",
+		false
+	);
+
 	parameters()->addParameter( m_channelNamesParameter );
 	parameters()->addParameter( m_rawChannelsParameter );
+	parameters()->addParameter( m_dataWindowParameter );
+	parameters()->addParameter( m_sharedCacheParameter );
 }
 
 ImageReader::ImageReader( const string &fileName ) : ImageReader()
@@ -460,14 +631,21 @@ ObjectPtr ImageReader::doOperation( const CompoundObject *operands )
 {
 	bool rawChannels = operands->member< BoolData >( "rawChannels" )->readable();
 
-	ImagePrimitivePtr image = new ImagePrimitive( dataWindow(), displayWindow() );
+	Box2i window = operands->member<Box2iData>( "dataWindow" )->readable();
+	if( window.isEmpty() )
+	{
+		window = dataWindow();
+	}
+
+	ImagePrimitivePtr image = new ImagePrimitive( window, displayWindow() );
 
 	vector<string> channelNames;
 	channelsToRead( channelNames );
 
+	vector<DataPtr> channels = m_implementation->readChannels( channelNames, rawChannels );
 	for( size_t ci = 0, cend = channelNames.size(); ci != cend; ++ci )
 	{
-		DataPtr d = m_implementation->readChannel( channelNames[ci], rawChannels );
+		DataPtr d = channels[ci];
 		assert( d  );
 		assert( rawChannels || d->typeId()==FloatVectorDataTypeId );
 
@@ -483,7 +661,24 @@ ObjectPtr ImageReader::doOperation( const CompoundObject *operands )
 
 DataPtr ImageReader::readChannel( const std::string &name, bool raw )
 {
-	return m_implementation->readChannel( name, raw );
+	return m_implementation->readChannels( { name }, raw )[0];
+}
+
+std::vector<DataPtr> ImageReader::readChannels( const std::vector<std::string> &names, bool raw )
+{
+	return m_implementation->readChannels( names, raw );
+}
+
+void ImageReader::setSharedCacheMemoryLimit( size_t megabytes )
+{
+	Implementation::sharedCache()->attribute( "max_memory_MB", (float)megabytes );
+}
+
+size_t ImageReader::getSharedCacheMemoryLimit()
+{
+	float megabytes = 0;
+	Implementation::sharedCache()->getattribute( "max_memory_MB", megabytes );
+	return (size_t)megabytes;
 }
 
 void ImageReader::channelsToRead( vector<string> &names )
@@ -533,6 +728,26 @@ const BoolParameter *ImageReader::rawChannelsParameter() const
 	return m_rawChannelsParameter.get();
 }
 
+Box2iParameter *ImageReader::dataWindowParameter()
+{
+	return m_dataWindowParameter.get();
+}
+
+const Box2iParameter *ImageReader::dataWindowParameter() const
+{
+	return m_dataWindowParameter.get();
+}
+
+BoolParameter *ImageReader::sharedCacheParameter()
+{
+	return m_sharedCacheParameter.get();
+}
+
+const BoolParameter *ImageReader::sharedCacheParameter() const
+{
+	return m_sharedCacheParameter.get();
+}
+
 CompoundObjectPtr ImageReader::readHeader()
 {
 	std::vector<std::string> cn;
@@ -39,13 +39,12 @@
 #include "IECoreImage/OpenImageIOAlgo.h"
 
 #include "IECore/CompoundParameter.h"
-#include "IECore/DataInterleaveOp.h"
 #include "IECore/DespatchTypedData.h"
 #include "IECore/Exception.h"
 #include "IECore/FileNameParameter.h"
 #include "IECore/MessageHandler.h"
-#include "IECore/ObjectVector.h"
 #include "IECore/TypedParameter.h"
+#include "IECore/VectorTypedData.h"
 
 #include "OpenImageIO/imageio.h"
 
@@ -59,6 +58,9 @@
 #include "boost/static_assert.hpp"
 #include "boost/type_traits.hpp"
 
+#include "tbb/parallel_for.h"
+#include "tbb/task_group.h"
+
 #ifndef _MSC_VER
 #include <sys/utsname.h>
 #endif
@@ -232,6 +234,196 @@ void setImageSpecFormatOptions( const CompoundObject *operands, ImageSpec *spec,
 	}
 }
 
+// Writes the channels of an image to an open ImageOutput, interleaving
+// them in parallel a chunk of scanlines at a time. While one chunk is being
+// written (and compressed) by the ImageOutput, the next is interleaved on
+// other threads. Because only two chunks are interleaved at once, we never
+// need an interleaved copy of the whole image. Passing several scanlines to
+// the ImageOutput at once also allows formats such as OpenEXR to compress
+// them in parallel.
+struct ScanlineWriter
+{
+
+	typedef void ReturnType;
+
+	ScanlineWriter(
+		ImageOutput *out, const ImageSpec &spec, const Box2i &dataWindow,
+		const std::vector<const Data *> &channels, const std::vector<bool> &colorConvert,
+		const std::string &inputSpace, const std::string &outputSpace
+	)
+		:	m_out( out ), m_spec( spec ), m_dataWindow( dataWindow ), m_channels( channels ),
+			m_colorConvert( colorConvert ), m_inputSpace( inputSpace ), m_outputSpace( outputSpace )
+	{
+	}
+
+	template<typename T>
+	ReturnType operator()( const T *firstChannel )
+	{
+		typedef typename T::ValueType::value_type ElementType;
+
+		const OpenImageIOAlgo::DataView dataView( firstChannel );
+		if( dataView.type == TypeDesc::UNKNOWN )
+		{
+			throw IECore::Exception( boost::str( boost::format( "IECoreImage::ImageWriter : Unsupported dataType %s." ) % firstChannel->typeName() ) );
+		}
+		const TypeDesc format( dataView.type.basetype );
+
+		const size_t numChannels = m_channels.size();
+		const size_t width = m_spec.width;
+		const int dataWidth = m_dataWindow.size().x + 1;
+		const bool anyColorConvert = std::find( m_colorConvert.begin(), m_colorConvert.end(), true ) != m_colorConvert.end();
+
+		std::vector<const ElementType *> channelData;
+		for( const auto &channel : m_channels )
+		{
+			channelData.push_back( static_cast<const T *>( channel )->readable().data() );
+		}
+
+		// Fills `buffer` with the interleaved scanlines starting at `chunkBegin`
+		// (relative to m_spec.y), colour converting them if necessary.
+		auto interleave = [&]( int chunkBegin, int chunkEnd, std::vector<ElementType> &buffer )
+		{
+			buffer.resize( ( chunkEnd - chunkBegin ) * width * numChannels );
+
+			// The data window rows overlapping this chunk.
+			const int dataBegin = std::max( m_spec.y + chunkBegin, m_dataWindow.min.y );
+			const int dataEnd = std::min( m_spec.y + chunkEnd, m_dataWindow.max.y + 1 );
+
+			std::vector<const ElementType *> sources = channelData;
+			std::vector<size_t> sourceOffsets( numChannels, 0 );
+			std::vector<typename T::Ptr> converted( numChannels );
+			if( anyColorConvert && dataBegin < dataEnd )
+			{
+				// Convert a copy of just the rows we need, rather than the
+				// whole image.
+				const size_t offset = ( dataBegin - m_dataWindow.min.y ) * dataWidth;
+				const size_t size = ( dataEnd - dataBegin ) * dataWidth;
+				tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+				tbb::parallel_for(
+					tbb::blocked_range<size_t>( 0, numChannels, 1 ),
+					[&]( const tbb::blocked_range<size_t> &range )
+					{
+						for( size_t c = range.begin(); c != range.end(); ++c )
+						{
+							if( !m_colorConvert[c] )
+							{
+								continue;
+							}
+							converted[c] = new T;
+							converted[c]->writable().assign( channelData[c] + offset, channelData[c] + offset + size );
+							ColorAlgo::transformChannel( converted[c].get(), m_inputSpace, m_outputSpace );
+							sources[c] = converted[c]->readable().data();
+							sourceOffsets[c] = offset;
+						}
+					},
+					taskGroupContext
+				);
+			}
+
+			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+			tbb::parallel_for(
+				tbb::blocked_range<int>( chunkBegin, chunkEnd ),
+				[&]( const tbb::blocked_range<int> &range )
+				{
+					for( int y = range.begin(); y != range.end(); ++y )
+					{
+						ElementType *out = buffer.data() + ( y - chunkBegin ) * width * numChannels;
+						const int dataY = m_spec.y + y;
+						if( dataY < m_dataWindow.min.y || dataY > m_dataWindow.max.y )
+						{
+							std::fill( out, out + width * numChannels, ElementType( 0 ) );
+							continue;
+						}
+
+						const size_t rowOffset = ( dataY - m_dataWindow.min.y ) * dataWidth;
+						for( size_t x = 0; x < width; ++x )
+						{
+							const int dataX = m_spec.x + (int)x - m_dataWindow.min.x;
+							if( dataX < 0 || dataX >= dataWidth )
+							{
+								std::fill( out, out + numChannels, ElementType( 0 ) );
+							}
+							else
+							{
+								for( size_t c = 0; c < numChannels; ++c )
+								{
+									out[c] = sources[c][rowOffset + dataX - sourceOffsets[c]];
+								}
+							}
+							out += numChannels;
+						}
+					}
+				},
+				taskGroupContext
+			);
+		};
+
+		const int chunkSize = scanlinesPerChunk( m_out->format_name() );
+		std::vector<ElementType> buffers[2];
+		int chunkIndex = 0;
+
+		interleave( 0, std::min( chunkSize, m_spec.height ), buffers[0] );
+		for( int chunkBegin = 0; chunkBegin < m_spec.height; chunkBegin += chunkSize, chunkIndex = 1 - chunkIndex )
+		{
+			const int chunkEnd = std::min( chunkBegin + chunkSize, m_spec.height );
+
+			// Interleave the next chunk while writing this one.
+			tbb::task_group taskGroup;
+			const int nextEnd = std::min( chunkEnd + chunkSize, m_spec.height );
+			if( chunkEnd < m_spec.height )
+			{
+				taskGroup.run(
+					[&interleave, &buffers, chunkEnd, nextEnd, chunkIndex] {
+						interleave( chunkEnd, nextEnd, buffers[1-chunkIndex] );
+					}
+				);
+			}
+
+			bool status;
+			try
+			{
+				status = m_out->write_scanlines(
+					/* ybegin */ m_spec.y + chunkBegin,
+					/* yend */ m_spec.y + chunkEnd,
+					/* z */ 0,
+					/* format */ format,
+					/* data */ buffers[chunkIndex].data()
+				);
+			}
+			catch( ... )
+			{
+				taskGroup.wait();
+				throw;
+			}
+
+			taskGroup.wait();
+
+			if( !status )
+			{
+				throw IECore::Exception( m_out->geterror() );
+			}
+		}
+	}
+
+	private :
+
+		// Formats which compress blocks of scanlines benefit
+		// from being given a whole number of blocks at once.
+		static int scanlinesPerChunk( const std::string &formatName )
+		{
+			return formatName == "openexr" ? 256 : 64;
+		}
+
+		ImageOutput *m_out;
+		const ImageSpec &m_spec;
+		const Box2i &m_dataWindow;
+		const std::vector<const Data *> &m_channels;
+		const std::vector<bool> &m_colorConvert;
+		const std::string &m_inputSpace;
+		const std::string &m_outputSpace;
+
+};
+
 } // namespace
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -578,96 +770,31 @@ void ImageWriter::doWrite( const CompoundObject *operands )
 		throw IECore::Exception( boost::str( boost::format( "IECoreImage::ImageWriter : Could not open \"%s\", error = %s" ) % fileName() % out->geterror() ) );
 	}
 
-	ImagePrimitivePtr correctedImage = nullptr;
+	std::string linearColorSpace;
+	std::string targetColorSpace;
 	if( !operands->member<const BoolData>( "rawChannels" )->readable() )
 	{
-		std::string linearColorSpace = OpenImageIOAlgo::colorSpace( "", spec );
-		std::string targetColorSpace = OpenImageIOAlgo::colorSpace( out->format_name(), spec );
-		if( linearColorSpace != targetColorSpace )
-		{
-			correctedImage = image->copy();
-			ColorAlgo::transformImage( correctedImage.get(), linearColorSpace, targetColorSpace );
-		}
+		linearColorSpace = OpenImageIOAlgo::colorSpace( "", spec );
+		targetColorSpace = OpenImageIOAlgo::colorSpace( out->format_name(), spec );
 	}
 
-	const auto &channelMap = ( correctedImage ) ? correctedImage->channels : image->channels;
-
-	DataInterleaveOpPtr op = new DataInterleaveOp();
-	op->targetTypeParameter()->setNumericValue( firstChannelData->typeId() );
-	auto &vectors = static_cast<ObjectVector *>( op->dataParameter()->getValue() )->members();
-	vectors.reserve( (size_t)spec.nchannels );
+	std::vector<const Data *> channelData;
+	std::vector<bool> colorConvert;
 	for( const auto &channel : channels )
 	{
-		vectors.push_back( channelMap.find( channel )->second );
+		channelData.push_back( image->channels.find( channel )->second.get() );
+		// Matches ColorAlgo::transformImage(), which doesn't convert alpha or depth.
+		colorConvert.push_back( linearColorSpace != targetColorSpace && channel != "A" && channel != "Z" );
 	}
 
-	DataPtr buffer = static_pointer_cast<Data>( op->operate() );
-	const OpenImageIOAlgo::DataView dataView( buffer.get() );
-	if( dataView.type == TypeDesc::UNKNOWN )
+	try
 	{
-		throw IECore::Exception( boost::str( boost::format( "IECoreImage::ImageWriter : Failed to write \"%s\". Unsupported dataType %s." ) % fileName() % buffer->typeName() ) );
+		ScanlineWriter scanlineWriter( out.get(), spec, dataWindow, channelData, colorConvert, linearColorSpace, targetColorSpace );
+		despatchTypedData<ScanlineWriter, TypeTraits::IsNumericVectorTypedData>( const_cast<Data *>( firstChannelData ), scanlineWriter );
 	}
-
-	const unsigned char *rawBuffer = (const unsigned char *)dataView.data;
-	size_t stride = spec.nchannels * spec.width * dataView.type.elementsize();
-
-	IECore::UCharVectorDataPtr scanLineData = new IECore::UCharVectorData();
-	std::vector<unsigned char>& scanLineBuffer = scanLineData->writable();
-	scanLineBuffer.resize(stride);
-
-	auto getScanLine = [&rawBuffer, &spec, &stride, &dataWindow, &dataView, validDisplayWindow, &scanLineBuffer](int y) -> const unsigned char*
-	{
-		if ( validDisplayWindow )
-		{
-			return &rawBuffer[stride * y];
-		}
-		else
-		{
-			memset( &scanLineBuffer[0], 0, stride );
-
-			// ensure the dataWindow is inside the image display window
-			int clampedXStart = std::max( dataWindow.min.x, 0 );
-			int clampedWidth = std::min( dataWindow.size().x + 1, (spec.width - clampedXStart) );
-
-			size_t dataWindowStride = ( dataWindow.size().x + 1) * spec.nchannels * dataView.type.elementsize();
-			size_t bytesToCopy = clampedWidth  * spec.nchannels * dataView.type.elementsize();
-
-			if( y < dataWindow.min.y )
-			{
-				return &scanLineBuffer[0];
-			}
-			else if( y > dataWindow.max.y )
-			{
-				return &scanLineBuffer[0];
-			}
-			else
-			{
-				if ( clampedWidth > 0 )
-				{
-					memcpy(
-						&scanLineBuffer[clampedXStart * spec.nchannels * dataView.type.elementsize()],
-						&rawBuffer[dataWindowStride * ( y - dataWindow.min.y )],
-						bytesToCopy
-					);
-				}
-				return &scanLineBuffer[0];
-			}
-		}
-	};
-
-	for( int y = 0; y < spec.height; ++y )
+	catch( const std::exception &e )
 	{
-		bool status = out->write_scanline(
-			/* y */ spec.y + y,
-			/* z */ 0,
-			/* format */ dataView.type,
-			/* data */ getScanLine( y )
-		);
-
-		if( !status )
-		{
-			throw IECore::Exception( boost::str( boost::format( "IECoreImage::ImageWriter : Failed to write \"%s\", error = %s" ) % fileName() % out->geterror() ) );
-		}
+		throw IECore::Exception( boost::str( boost::format( "IECoreImage::ImageWriter : Failed to write \"%s\", error = %s" ) % fileName() % e.what() ) );
 	}
 
 	out->close();
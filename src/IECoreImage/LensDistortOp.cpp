@@ -42,10 +42,16 @@
 #include "IECore/FastFloat.h"
 #include "IECore/Interpolator.h"
 #include "IECore/LensModel.h"
+#include "IECore/LRUCache.h"
+#include "IECore/MurmurHash.h"
 #include "IECore/NullObject.h"
 #include "IECore/ObjectParameter.h"
 #include "IECore/TypeTraits.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/parallel_for.h"
+
 #include <cassert>
 
 using namespace boost;
@@ -55,6 +61,165 @@ using namespace IECoreImage;
 
 IE_CORE_DEFINERUNTIMETYPED( LensDistortOp );
 
+namespace
+{
+
+// The distorted data window and the map of distorted positions
+// for each pixel within it.
+struct DistortionMap
+{
+	Imath::Box2i dataWindow;
+	ConstV2fVectorDataPtr positions;
+};
+
+// The key for the distortion map cache is a hash of the lens
+// parameters, mode and windows, but the getter also needs the
+// lens model itself.
+struct DistortionMapKey
+{
+
+	DistortionMapKey()
+		:	lensModel( nullptr ), lensParameters( nullptr ), distort( false )
+	{
+	}
+
+	DistortionMapKey( LensModel *lensModel, const CompoundObject *lensParameters, bool distort, const Box2i &dataWindow, const Box2i &displayWindow )
+		:	lensModel( lensModel ), lensParameters( lensParameters ), distort( distort ), dataWindow( dataWindow ), displayWindow( displayWindow )
+	{
+		lensParameters->hash( hash );
+		hash.append( distort );
+		hash.append( dataWindow );
+		hash.append( displayWindow );
+	}
+
+	bool operator == ( const DistortionMapKey &other ) const
+	{
+		return hash == other.hash;
+	}
+
+	operator const MurmurHash & () const
+	{
+		return hash;
+	}
+
+	LensModel *lensModel;
+	const CompoundObject *lensParameters;
+	bool distort;
+	Box2i dataWindow;
+	Box2i displayWindow;
+	MurmurHash hash;
+
+};
+
+DistortionMap computeDistortionMap( const DistortionMapKey &key, size_t &cost )
+{
+	const Box2i &dataWindow = key.dataWindow;
+	const Box2i &displayWindow = key.displayWindow;
+	const V2d displayWH( displayWindow.size().x + 1, displayWindow.size().y + 1 );
+	const V2d displayOrigin( displayWindow.min.x, displayWindow.min.y );
+
+	// Get the distorted window.
+	// As the LensModel::bounds() method requires that the display window has it's origin at (0,0) in the bottom left of the image and the ImagePrimitive has it's origin in the top left,
+	// convert to the correct image space and offset if by the display window's origin if it is non-zero.
+	Imath::Box2i distortionSpaceBox(
+		Imath::V2i( dataWindow.min[0] - displayWindow.min[0], displayWindow.size().y - ( dataWindow.max[1] - displayWindow.min[1] ) ),
+		Imath::V2i( dataWindow.max[0] - displayWindow.min[0], displayWindow.size().y - ( dataWindow.min[1] - displayWindow.min[1] ) )
+	);
+
+	// Calculate the distorted data window. Because we pull each output pixel from the
+	// input image, the window uses the opposite mapping to the one used for the pixels.
+	Imath::Box2i distortedWindow = key.lensModel->bounds( key.distort ? LensModel::Undistort : LensModel::Distort, distortionSpaceBox, ( displayWindow.size().x + 1 ), ( displayWindow.size().y + 1 ) );
+
+	DistortionMap result;
+
+	// Convert the distorted data window back to the same image space as ImagePrimitive.
+	result.dataWindow = Imath::Box2i(
+		Imath::V2i( distortedWindow.min[0] + displayWindow.min[0], ( displayWindow.size().y - distortedWindow.max[1] ) + displayWindow.min[1] ),
+		Imath::V2i( distortedWindow.max[0] + displayWindow.min[0], ( displayWindow.size().y - distortedWindow.min[1] ) + displayWindow.min[1] )
+	);
+
+	// Compute the UV coordinates of every pixel, with the origin in the bottom left,
+	// and distort them a block of rows at a time. LensModel implementations aren't
+	// required to be threadsafe, so each thread uses its own instance of the model.
+	const int width = distortedWindow.size().x + 1;
+	const int height = distortedWindow.size().y + 1;
+	std::vector<V2d> uvs( width * height );
+
+	tbb::enumerable_thread_specific<LensModelPtr> lensModels(
+		[&key] () {
+			LensModelPtr lensModel = LensModel::create( key.lensParameters );
+			lensModel->validate();
+			return lensModel;
+		}
+	);
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<int>( 0, height ),
+		[&]( const tbb::blocked_range<int> &range )
+		{
+			for( int row = range.begin(); row != range.end(); ++row )
+			{
+				const int y = distortedWindow.max.y - row;
+				V2d *uv = uvs.data() + row * width;
+				for( int x = distortedWindow.min.x; x <= distortedWindow.max.x; ++x )
+				{
+					*uv++ = V2d( float( x ) / displayWH[0], float( y ) / displayWH[1] );
+				}
+			}
+
+			V2d *rangeUVs = uvs.data() + range.begin() * width;
+			const size_t count = range.size() * width;
+			LensModel *lensModel = lensModels.local().get();
+			if( key.distort )
+			{
+				lensModel->distortPoints( rangeUVs, rangeUVs, count );
+			}
+			else
+			{
+				lensModel->undistortPoints( rangeUVs, rangeUVs, count );
+			}
+		},
+		taskGroupContext
+	);
+
+	// Transform to image space.
+	V2fVectorDataPtr positionsData = new V2fVectorData;
+	std::vector<V2f> &positions = positionsData->writable();
+	positions.resize( uvs.size() );
+
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, uvs.size() ),
+		[&]( const tbb::blocked_range<size_t> &range )
+		{
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				const V2d &duv = uvs[i];
+				positions[i] = V2f(
+					duv[0] * displayWH[0] + displayOrigin[0], ( ( displayWH[1] - 1. ) - ( duv[1] * displayWH[1] ) ) + displayOrigin[1]
+				);
+			}
+		},
+		taskGroupContext
+	);
+
+	result.positions = positionsData;
+	cost = positionsData->memoryUsage();
+	return result;
+}
+
+// Maps are cached so that sequences of images with the same lens and
+// resolution only need to compute them once.
+typedef LRUCache<MurmurHash, DistortionMap, LRUCachePolicy::Parallel, DistortionMapKey> DistortionMapCache;
+
+DistortionMapCache &distortionMapCache()
+{
+	static DistortionMapCache g_cache( computeDistortionMap, 500 * 1024 * 1024 );
+	return g_cache;
+}
+
+} // namespace
+
 LensDistortOp::LensDistortOp()
 	:	WarpOp(
 			"Distorts an ImagePrimitive using a parametric lens model which is supplied as a .cob file. "
@@ -116,55 +281,12 @@ void LensDistortOp::begin( const CompoundObject * operands )
 	assert( runTimeCast< ImagePrimitive >(inputParameter()->getValue()) );
 	ImagePrimitive *inputImage = static_cast<ImagePrimitive *>( inputParameter()->getValue() );
 
-	Imath::Box2i dataWindow( inputImage->getDataWindow() );
-	Imath::Box2i displayWindow( inputImage->getDisplayWindow() );
-	double displayWH[2] = { static_cast<double>( displayWindow.size().x + 1 ), static_cast<double>( displayWindow.size().y + 1 ) };
-	double displayOrigin[2] = { static_cast<double>( displayWindow.min[0] ), static_cast<double>( displayWindow.min[1] ) };
-
-	// Get the distorted window.
-	// As the LensModel::bounds() method requires that the display window has it's origin at (0,0) in the bottom left of the image and the ImagePrimitive has it's origin in the top left,
-	// convert to the correct image space and offset if by the display window's origin if it is non-zero.
-	Imath::Box2i distortionSpaceBox(
-		Imath::V2i( dataWindow.min[0] - displayWindow.min[0], displayWindow.size().y - ( dataWindow.max[1] - displayWindow.min[1] ) ),
-		Imath::V2i( dataWindow.max[0] - displayWindow.min[0], displayWindow.size().y - ( dataWindow.min[1] - displayWindow.min[1] ) )
-	);
-
-	// Calculate the distorted data window.
-	Imath::Box2i distortedWindow = m_lensModel->bounds( m_mode, distortionSpaceBox, ( displayWindow.size().x + 1 ), ( displayWindow.size().y + 1 ) );
-
-	// Convert the distorted data window back to the same image space as ImagePrimitive.
-	m_distortedDataWindow =  Imath::Box2i(
-		Imath::V2i( distortedWindow.min[0] + displayWindow.min[0], ( displayWindow.size().y - distortedWindow.max[1] ) + displayWindow.min[1] ),
-		Imath::V2i( distortedWindow.max[0] + displayWindow.min[0], ( displayWindow.size().y - distortedWindow.min[1] ) + displayWindow.min[1] )
+	const DistortionMap map = distortionMapCache().get(
+		DistortionMapKey( m_lensModel.get(), lensModelParams.get(), m_mode == kDistort, inputImage->getDataWindow(), inputImage->getDisplayWindow() )
 	);
 
-	// Compute a 2D cache of the warped points for use in the warp() method.
-	IECore::FloatVectorDataPtr cachePtr = new IECore::FloatVectorData;
-	std::vector<float> &cache( cachePtr->writable() );
-	cache.resize( ( m_distortedDataWindow.size().x + 1 ) * ( m_distortedDataWindow.size().y + 1 ) * 2 ); // We interleave the X and Y vector components within the cache.
-
-	for( int y = distortedWindow.max.y, pixelIndex = 0; y >= distortedWindow.min.y; --y )
-	{
-		for( int x = distortedWindow.min.x; x <= distortedWindow.max.x; ++x )
-		{
-			// Convert to UV space with the origin in the bottom left.
-			Imath::V2f p( Imath::V2f( x, y ) );
-			Imath::V2d uv( p[0] / displayWH[0], p[1] / displayWH[1] );
-
-			// Get the distorted uv coordinate.
-			Imath::V2d duv( m_mode == kDistort ? m_lensModel->distort( uv ) : m_lensModel->undistort( uv ) );
-
-			// Transform it to image space.
-			p = Imath::V2f(
-				duv[0] * displayWH[0] + displayOrigin[0], ( ( displayWH[1] - 1. ) - ( duv[1] * displayWH[1] ) ) + displayOrigin[1]
-			);
-
-			cache[pixelIndex++] = p[0];
-			cache[pixelIndex++] = p[1];
-		}
-	}
-
-	m_cachePtr = cachePtr;
+	m_distortedDataWindow = map.dataWindow;
+	m_distortionMap = map.positions;
 }
 
 Imath::Box2i LensDistortOp::warpedDataWindow( const Imath::Box2i &dataWindow ) const
@@ -178,8 +300,7 @@ Imath::V2f LensDistortOp::warp( const Imath::V2f &p ) const
 	const int w( m_distortedDataWindow.size().x + 1 );
 	const int xIdx( int( p[0] ) - m_distortedDataWindow.min.x );
 	const int yIdx( int( p[1] ) - m_distortedDataWindow.min.y );
-	const float *vector( &(( m_cachePtr->readable() )[ ( w * yIdx + xIdx ) * 2 ] ) );
-	return Imath::V2f( vector[0], vector[1] );
+	return m_distortionMap->readable()[ w * yIdx + xIdx ];
 }
 
 void LensDistortOp::end()
@@ -35,7 +35,7 @@
 #include "IECoreImage/MedianCutSampler.h"
 
 #include "IECoreImage/ImagePrimitive.h"
-#include "IECoreImage/SummedAreaOp.h"
+#include "IECoreImage/SummedAreaTable.h"
 
 #include "IECore/CompoundObject.h"
 #include "IECore/CompoundParameter.h"
@@ -43,7 +43,6 @@
 #include "IECore/NullObject.h"
 
 #include "boost/format.hpp"
-#include "boost/multi_array.hpp"
 
 using namespace std;
 using namespace boost;
@@ -151,25 +150,41 @@ const IntParameter * MedianCutSampler::projectionParameter() const
 	return m_projectionParameter.get();
 }
 
-/// \todo This functionality and the code in SummedAreaOp should be
-/// refactored into a low level templated SummedAreaTable class that
-/// operates on data passed to it.
-typedef boost::multi_array_ref<float, 2> Array2D;
-static inline float energy( const Array2D &summedLuminance, const Box2i &area )
+namespace
 {
-	V2i min = area.min - V2i( 1 ); // box is inclusive so we need to step outside
 
-	float a = summedLuminance[area.max.x][area.max.y];
-	float b = min.y >= 0 ? summedLuminance[area.max.x][min.y] : 0.0f;
-	float c = min.x >= 0 ? summedLuminance[min.x][area.max.y] : 0.0f;
-	float d = min.x >= 0 && min.y >= 0 ? summedLuminance[min.x][min.y] : 0.0f;
+/// The luminance channel being sampled, along with the per-row weights
+/// applied to account for the projection, and a summed area table of
+/// the weighted luminance.
+struct Luminance
+{
 
-	return a - b - c + d;
-}
+	Luminance( const float *values, const V2i &size, const vector<float> &rowWeights )
+		:	values( values ), size( size ), rowWeights( rowWeights ),
+			table( size, [values, &size, &rowWeights]( int x, int y ) { return values[(size_t)y * size.x + x] * rowWeights[y]; } )
+	{
+	}
+
+	float operator()( int x, int y ) const
+	{
+		return values[(size_t)y * size.x + x] * rowWeights[y];
+	}
+
+	double energy( const Box2i &area ) const
+	{
+		return table.sum( area );
+	}
 
-static void medianCut( const Array2D &luminance, const Array2D &summedLuminance, MedianCutSampler::Projection projection, const Box2i &area, vector<Box2i> &areas, vector<V2f> &centroids, int depth, int maxDepth )
+	const float *values;
+	const V2i size;
+	const vector<float> &rowWeights;
+	const SummedAreaTable<> table;
+
+};
+
+void medianCut( const Luminance &luminance, MedianCutSampler::Projection projection, const Box2i &area, vector<Box2i> &areas, vector<V2f> &centroids, int depth, int maxDepth )
 {
-	float radiansPerPixel = M_PI / (luminance.shape()[1]);
+	float radiansPerPixel = M_PI / luminance.size.y;
 
 	if( depth==maxDepth )
 	{
@@ -179,7 +194,7 @@ static void medianCut( const Array2D &luminance, const Array2D &summedLuminance,
 		{
 			for( int x=area.min.x; x<=area.max.x; x++ )
 			{
-				float e = luminance[x][y];
+				float e = luminance( x, y );
 				position += V2f( x, y ) * e;
 				totalEnergy += e;
 			}
@@ -200,69 +215,55 @@ static void medianCut( const Array2D &luminance, const Array2D &summedLuminance,
 			size.x *= cosf( centreAngle );
 		}
 		int cutAxis = size.x > size.y ? 0 : 1;
-		float e = energy( summedLuminance, area );
-		float halfE = e / 2.0f;
+		double e = luminance.energy( area );
+		double halfE = e / 2.0;
 		Box2i lowArea = area;
 		while( e > halfE )
 		{
 			lowArea.max[cutAxis] -= 1;
-			e = energy( summedLuminance, lowArea );
+			e = luminance.energy( lowArea );
 		}
 		Box2i highArea = area;
 		highArea.min[cutAxis] = lowArea.max[cutAxis] + 1;
-		medianCut( luminance, summedLuminance, projection, lowArea, areas, centroids, depth + 1, maxDepth );
-		medianCut( luminance, summedLuminance, projection, highArea, areas, centroids, depth + 1, maxDepth );
+		medianCut( luminance, projection, lowArea, areas, centroids, depth + 1, maxDepth );
+		medianCut( luminance, projection, highArea, areas, centroids, depth + 1, maxDepth );
 	}
 }
 
+} // namespace
 
 ObjectPtr MedianCutSampler::doOperation( const CompoundObject * operands )
 {
-	ImagePrimitivePtr image = static_cast<ImagePrimitive *>( imageParameter()->getValue() )->copy();
+	const ImagePrimitive *image = static_cast<const ImagePrimitive *>( imageParameter()->getValue() );
 	Box2i dataWindow = image->getDataWindow();
 
 	// find the right channel
 	const std::string &channelName = m_channelNameParameter->getTypedValue();
-	FloatVectorDataPtr luminance = image->getChannel<float>( channelName );
-	if( !luminance )
+	const FloatVectorData *luminanceData = image->getChannel<float>( channelName );
+	if( !luminanceData )
 	{
 		throw Exception( str( format( "No FloatVectorData channel named \"%s\"." ) % channelName ) );
 	}
 
 	// if the projection requires it, weight the luminances so they're less
-	// important towards the poles of the sphere
+	// important towards the poles of the sphere. rather than modify a copy
+	// of the channel, we apply the weights on the fly.
+	const V2i size = dataWindow.size() + V2i( 1 );
 	Projection projection = (Projection)m_projectionParameter->getNumericValue();
+	vector<float> rowWeights( size.y, 1.0f );
 	if( projection==LatLong )
 	{
-		float radiansPerPixel = M_PI / (dataWindow.size().y + 1);
+		float radiansPerPixel = M_PI / size.y;
 		float angle = ( M_PI - radiansPerPixel ) / 2.0f;
-
-		float *p = &(luminance->writable()[0]);
-
-		for( int y=dataWindow.min.y; y<=dataWindow.max.y; y++ )
+		for( int y=0; y<size.y; y++ )
 		{
-			float *pEnd = p + dataWindow.size().x + 1;
-			float w = cosf( angle );
-			while( p < pEnd )
-			{
-				*p *= w;
-				p++;
-			}
+			rowWeights[y] = cosf( angle );
 			angle -= radiansPerPixel;
 		}
-
 	}
 
 	// make a summed area table for speed
-	FloatVectorDataPtr summedLuminance = luminance;
-	luminance = luminance->copy(); // we need this for the centroid computation
-
-	SummedAreaOpPtr summedAreaOp = new SummedAreaOp();
-	summedAreaOp->inputParameter()->setValue( image );
-	summedAreaOp->copyParameter()->setTypedValue( false );
-	summedAreaOp->channelNamesParameter()->getTypedValue().clear();
-	summedAreaOp->channelNamesParameter()->getTypedValue().push_back( "Y" );
-	summedAreaOp->operate();
+	const Luminance luminance( luminanceData->readable().data(), size, rowWeights );
 
 	// do the median cut thing
 	CompoundObjectPtr result = new CompoundObject;
@@ -273,10 +274,7 @@ ObjectPtr MedianCutSampler::doOperation( const CompoundObject * operands )
 
 	dataWindow.max -= dataWindow.min;
 	dataWindow.min -= dataWindow.min; // let's start indexing from 0 shall we?
-	Array2D array( &(luminance->writable()[0]), extents[dataWindow.size().x+1][dataWindow.size().y+1], fortran_storage_order() );
-	Array2D summedArray( &(summedLuminance->writable()[0]), extents[dataWindow.size().x+1][dataWindow.size().y+1], fortran_storage_order() );
-	medianCut( array, summedArray, projection, dataWindow, areas->writable(), centroids->writable(), 0, subdivisionDepthParameter()->getNumericValue() );
+	medianCut( luminance, projection, dataWindow, areas->writable(), centroids->writable(), 0, subdivisionDepthParameter()->getNumericValue() );
 
 	return result;
 }
-
@@ -34,9 +34,14 @@
 
 #include "IECoreImage/SummedAreaOp.h"
 
+#include "IECoreImage/SummedAreaTable.h"
+
 #include "IECore/DespatchTypedData.h"
 #include "IECore/TypeTraits.h"
 
+#include <limits>
+#include <type_traits>
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -70,29 +75,37 @@ struct SummedAreaOp::SumArea
 
 		Container &buffer = data->writable();
 
-		// deal with first row alone, as it doesn't have values above it
-		unsigned pixelIndex=0;
-		V rowSum = 0;
-		for( int x=m_dataWindow.min.x; x<=m_dataWindow.max.x; x++, pixelIndex++ )
+		const SummedAreaTable<> table( m_dataWindow.size() + V2i( 1 ), buffer.data() );
+		const vector<double> &sums = table.table();
+		for( size_t i = 0, e = buffer.size(); i < e; ++i )
+		{
+			buffer[i] = convert<V>( sums[i], std::is_integral<V>() );
+		}
+	}
+
+	private :
+
+		template<typename V>
+		static V convert( double sum, std::false_type )
 		{
-			rowSum += buffer[pixelIndex];
-			buffer[pixelIndex] = rowSum;
+			return V( sum );
 		}
-		// now do the other rows
-		unsigned upperPixelIndex = 0;
-		pixelIndex = m_dataWindow.size().x + 1;
-		for( int y=m_dataWindow.min.y + 1; y<=m_dataWindow.max.y; y++ )
+
+		// Converting an out of range value to an integer type is undefined, so
+		// sums which overflow the channel type are clamped to its range.
+		template<typename V>
+		static V convert( double sum, std::true_type )
 		{
-			rowSum = 0;
-			for( int x=m_dataWindow.min.x; x<=m_dataWindow.max.x; x++ )
+			if( sum >= double( std::numeric_limits<V>::max() ) )
+			{
+				return std::numeric_limits<V>::max();
+			}
+			else if( sum <= double( std::numeric_limits<V>::lowest() ) )
 			{
-				rowSum += buffer[pixelIndex];
-				buffer[pixelIndex++] = rowSum + buffer[upperPixelIndex++];
+				return std::numeric_limits<V>::lowest();
 			}
+			return V( sum );
 		}
-	}
-
-	private :
 
 		Box2i m_dataWindow;
 
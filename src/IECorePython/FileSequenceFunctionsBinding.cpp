@@ -37,6 +37,7 @@
 #include "IECorePython/FileSequenceFunctionsBinding.h"
 
 #include "IECorePython/IECoreBinding.h"
+#include "IECorePython/ScopedGILRelease.h"
 
 #include "IECore/Exception.h"
 #include "IECore/FileSequence.h"
@@ -108,6 +109,40 @@ struct FileSequenceFunctionsHelper
 		return object();
 	}
 
+	static list lsMany( list pathsList, size_t minSequenceSize = 2 )
+	{
+		std::vector< std::string > paths;
+		for ( long i = 0; i < IECorePython::len( pathsList ); i++ )
+		{
+			extract< std::string > ex( pathsList[i] );
+			if ( !ex.check() )
+			{
+				throw InvalidArgumentException( "ls: List element is not a string" );
+			}
+
+			paths.push_back( ex() );
+		}
+
+		std::vector< std::vector< FileSequencePtr > > sequences;
+		{
+			ScopedGILRelease gilRelease;
+			IECore::ls( paths, sequences, minSequenceSize );
+		}
+
+		list result;
+		for ( std::vector< std::vector< FileSequencePtr > >::const_iterator it = sequences.begin(); it != sequences.end(); ++it )
+		{
+			list l;
+			for ( std::vector< FileSequencePtr >::const_iterator sIt = it->begin(); sIt != it->end(); ++sIt )
+			{
+				l.append( *sIt );
+			}
+			result.append( l );
+		}
+
+		return result;
+	}
+
 	static FrameListPtr frameListFromList( list l )
 	{
 		std::vector< FrameList::Frame > frameList;
@@ -131,6 +166,7 @@ void bindFileSequenceFunctions()
 {
 	def( "findSequences", &FileSequenceFunctionsHelper::findSequences, ( arg_("namesList"), arg_( "minSequenceSize" ) = 2 ) );
 	def( "ls", &FileSequenceFunctionsHelper::ls, ( arg_("path"), arg_( "minSequenceSize" ) = 2 ) );
+	def( "ls", &FileSequenceFunctionsHelper::lsMany, ( arg_("paths"), arg_( "minSequenceSize" ) = 2 ) );
 	def( "frameListFromList", &FileSequenceFunctionsHelper::frameListFromList );
 }
 
@@ -40,6 +40,7 @@
 
 #include "IECorePython/IECoreBinding.h"
 #include "IECorePython/RunTimeTypedBinding.h"
+#include "IECorePython/ScopedGILRelease.h"
 
 #include "IECore/CompoundData.h"
 #include "IECore/FileIndexedIO.h"
@@ -48,6 +49,9 @@
 #include "IECore/SimpleTypedData.h"
 #include "IECore/VectorTypedData.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
 #include <cassert>
 #include <iostream>
 
@@ -193,7 +197,7 @@ struct IndexedIOHelper
 		return x;
 	}
 
-	static object read(IndexedIOPtr p, const IndexedIO::EntryID &name)
+	static DataPtr readData(IndexedIOPtr p, const IndexedIO::EntryID &name)
 	{
 		assert(p);
 
@@ -202,60 +206,114 @@ struct IndexedIOHelper
 		switch( entry.dataType() )
 		{
 			case IndexedIO::Float:
-				return object( readSingle<float>(p, name, entry) );
+				return readSingle<float>(p, name, entry);
 			case IndexedIO::Double:
-				return object( readSingle<double>(p, name, entry) );
+				return readSingle<double>(p, name, entry);
 			case IndexedIO::Int:
-				return object( readSingle<int>(p, name, entry) );
+				return readSingle<int>(p, name, entry);
 			case IndexedIO::Long:
-				return object( readSingle<int>(p, name, entry) );
+				return readSingle<int>(p, name, entry);
 			case IndexedIO::String:
-				return object( readSingle<std::string>(p, name, entry) );
+				return readSingle<std::string>(p, name, entry);
 			case IndexedIO::StringArray:
-				return object( readArray<std::string>(p, name, entry) );
+				return readArray<std::string>(p, name, entry);
 			case IndexedIO::FloatArray:
-				return object( readArray<float>(p, name, entry) );
+				return readArray<float>(p, name, entry);
 			case IndexedIO::DoubleArray:
-				return object( readArray<double>(p, name, entry) );
+				return readArray<double>(p, name, entry);
 			case IndexedIO::IntArray:
-				return object( readArray<int>(p, name, entry) );
+				return readArray<int>(p, name, entry);
 			case IndexedIO::LongArray:
-				return object( readArray<int>(p, name, entry) );
+				return readArray<int>(p, name, entry);
 			case IndexedIO::UInt:
-				return object( readSingle<unsigned int>(p, name, entry) );
+				return readSingle<unsigned int>(p, name, entry);
 			case IndexedIO::UIntArray:
-				return object( readArray<unsigned int>(p, name, entry) );
+				return readArray<unsigned int>(p, name, entry);
 			case IndexedIO::Char:
-				return object( readSingle<char>(p, name, entry) );
+				return readSingle<char>(p, name, entry);
 			case IndexedIO::CharArray:
-				return object( readArray<char>(p, name, entry) );
+				return readArray<char>(p, name, entry);
 			case IndexedIO::UChar:
-				return object( readSingle<unsigned char>(p, name, entry) );
+				return readSingle<unsigned char>(p, name, entry);
 			case IndexedIO::UCharArray:
-				return object( readArray<unsigned char>(p, name, entry) );
+				return readArray<unsigned char>(p, name, entry);
 			case IndexedIO::Short:
-				return object( readSingle<short>(p, name, entry) );
+				return readSingle<short>(p, name, entry);
 			case IndexedIO::ShortArray:
-				return object( readArray<short>(p, name, entry) );
+				return readArray<short>(p, name, entry);
 			case IndexedIO::UShort:
-				return object( readSingle<unsigned short>(p, name, entry) );
+				return readSingle<unsigned short>(p, name, entry);
 			case IndexedIO::UShortArray:
-				return object( readArray<unsigned short>(p, name, entry) );
+				return readArray<unsigned short>(p, name, entry);
 			case IndexedIO::Int64:
-				return object( readSingle<int64_t>(p, name, entry) );
+				return readSingle<int64_t>(p, name, entry);
 			case IndexedIO::Int64Array:
-				return object( readArray<int64_t>(p, name, entry) );
+				return readArray<int64_t>(p, name, entry);
 			case IndexedIO::UInt64:
-				return object( readSingle<uint64_t>(p, name, entry) );
+				return readSingle<uint64_t>(p, name, entry);
 			case IndexedIO::UInt64Array:
-				return object( readArray<uint64_t>(p, name, entry) );
+				return readArray<uint64_t>(p, name, entry);
 			case IndexedIO::InternedStringArray:
-				return object( readArray<InternedString>(p, name, entry) );
+				return readArray<InternedString>(p, name, entry);
 			default:
 				throw IOException(name);
 		}
 	}
 
+	static object read(IndexedIOPtr p, const IndexedIO::EntryID &name)
+	{
+		assert(p);
+
+		DataPtr data;
+		{
+			IECorePython::ScopedGILRelease gilRelease;
+			data = readData( p, name );
+		}
+		return object( data );
+	}
+
+	// Reads several entries at once, returning a list of Data. Reads are
+	// only threadsafe for read-only files, so in other modes the entries
+	// are read serially.
+	static list readEntries(IndexedIOPtr p, list names)
+	{
+		assert(p);
+
+		IndexedIO::EntryIDList entryIDs;
+		listToEntryIds( names, entryIDs );
+
+		std::vector<DataPtr> data( entryIDs.size() );
+		{
+			IECorePython::ScopedGILRelease gilRelease;
+			if( !( p->openMode() & ( IndexedIO::Write | IndexedIO::Append ) ) )
+			{
+				tbb::parallel_for(
+					tbb::blocked_range<size_t>( 0, entryIDs.size() ),
+					[&p, &entryIDs, &data]( const tbb::blocked_range<size_t> &range ) {
+						for( size_t i = range.begin(); i != range.end(); ++i )
+						{
+							data[i] = readData( p, entryIDs[i] );
+						}
+					}
+				);
+			}
+			else
+			{
+				for( size_t i = 0; i < entryIDs.size(); ++i )
+				{
+					data[i] = readData( p, entryIDs[i] );
+				}
+			}
+		}
+
+		list result;
+		for( const auto &d : data )
+		{
+			result.append( d );
+		}
+		return result;
+	}
+
 	static std::string readString(IndexedIOPtr p, const IndexedIO::EntryID &name)
 	{
 		assert(p);
@@ -402,6 +460,7 @@ void bindIndexedIOBase()
 		.def("write", writeUShort)
 #endif
 		.def("read", &IndexedIOHelper::read)
+		.def("read", &IndexedIOHelper::readEntries)
 		.def("create", &IndexedIOHelper::create, (arg("path"), arg("root"), arg("mode"), arg("options") = object() ) )
 		.def("create", &IndexedIOHelper::createAtRoot, (arg("path"), arg("mode"), arg("options") = object() ) ).staticmethod("create")
 		.def("supportedExtensions", &IndexedIOHelper::supportedExtensions ).staticmethod("supportedExtensions")
@@ -61,6 +61,22 @@ static boost::python::list lensModelList()
 	return result;
 }
 
+static V2dVectorDataPtr distortPoints( LensModel &lensModel, const V2dVectorData *points )
+{
+	V2dVectorDataPtr result = new V2dVectorData;
+	result->writable().resize( points->readable().size() );
+	lensModel.distortPoints( points->readable().data(), result->writable().data(), points->readable().size() );
+	return result;
+}
+
+static V2dVectorDataPtr undistortPoints( LensModel &lensModel, const V2dVectorData *points )
+{
+	V2dVectorDataPtr result = new V2dVectorData;
+	result->writable().resize( points->readable().size() );
+	lensModel.undistortPoints( points->readable().data(), result->writable().data(), points->readable().size() );
+	return result;
+}
+
 namespace IECorePython
 {
 
@@ -72,6 +88,8 @@ void bindLensModel()
 	RunTimeTypedClass<LensModel> bind( "An abstract base class for modeling a lens' distortion." );
 	bind.def( "distort", &LensModel::distort );
 	bind.def( "undistort", &LensModel::undistort );
+	bind.def( "distortPoints", &distortPoints );
+	bind.def( "undistortPoints", &undistortPoints );
 	bind.def( "bounds", &LensModel::bounds );
 	bind.def( "validate", &LensModel::validate );
 	bind.attr( "Undistort" ) = int(LensModel::Undistort);
@@ -81,6 +81,7 @@ void bindObject()
 		.def( self == self )
 		.def( self != self )
 		.def( "copy", &Object::copy )
+		.def( "shallowCopy", &Object::shallowCopy )
 		.def( "copyFrom", (void (Object::*)( const Object * ) )&Object::copyFrom )
 		.def( "isType", (bool (*)( const std::string &) )&Object::isType )
 		.def( "isType", (bool (*)( TypeId) )&Object::isType )
@@ -36,10 +36,17 @@
 
 #include "IECorePython/RunTimeTypedBinding.h"
 
+#include "IECorePython/ScopedGILRelease.h"
+
 #include "IECore/RunTimeTyped.h"
 
 #include "boost/algorithm/string/find.hpp"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
+#include <atomic>
+
 using namespace boost::python;
 using namespace IECore;
 
@@ -86,6 +93,45 @@ static list derivedTypeIds( TypeId typeId )
 	return result;
 }
 
+// Calls inheritsFrom() for every combination of the specified types,
+// numIterations times, from many threads at once. Returns the total
+// number of calls for which inheritsFrom() returned true, so that the
+// result can be checked.
+static size_t testInheritsFromConcurrency( object pythonTypeIds, size_t numIterations )
+{
+	std::vector<TypeId> typeIds;
+	for( ssize_t i = 0, e = len( pythonTypeIds ); i < e; ++i )
+	{
+		typeIds.push_back( extract<TypeId>( pythonTypeIds[i] ) );
+	}
+
+	std::atomic<size_t> result( 0 );
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+		tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+		tbb::parallel_for(
+			tbb::blocked_range<size_t>( 0, numIterations ),
+			[&typeIds, &result]( const tbb::blocked_range<size_t> &range ) {
+				size_t count = 0;
+				for( size_t i = range.begin(); i != range.end(); ++i )
+				{
+					for( TypeId type : typeIds )
+					{
+						for( TypeId baseType : typeIds )
+						{
+							count += RunTimeTyped::inheritsFrom( type, baseType );
+						}
+					}
+				}
+				result += count;
+			},
+			taskGroupContext
+		);
+	}
+
+	return result;
+}
+
 void bindRunTimeTyped()
 {
 	RunTimeTypedClass<RunTimeTyped>()
@@ -98,6 +144,9 @@ void bindRunTimeTyped()
 		.def( "registerType",  &RunTimeTyped::registerType ).staticmethod( "registerType" )
 	;
 
+	/// \todo If we create an IECoreTest module, move this into it.
+	def( "testRunTimeTypedInheritsFromConcurrency", &testInheritsFromConcurrency );
+
 }
 
 }
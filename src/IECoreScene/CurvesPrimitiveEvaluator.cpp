@@ -44,6 +44,11 @@
 
 #include "OpenEXR/ImathFun.h"
 
+#include "boost/format.hpp"
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
 using namespace IECore;
 using namespace IECoreScene;
 using namespace Imath;
@@ -308,6 +313,11 @@ struct CurvesPrimitiveEvaluator::Line
 {
 	public :
 
+		Line()
+			:	m_curveIndex( 0 ), m_vMin( 0 ), m_vMax( 0 )
+		{
+		}
+
 		Line( const V3f &p1, const V3f &p2, unsigned curveIndex, float vMin, float vMax )
 			:	m_lineSegment( p1, p2 ), m_curveIndex( curveIndex ), m_vMin( vMin ), m_vMax( vMax )
 		{
@@ -642,72 +652,274 @@ float CurvesPrimitiveEvaluator::curveLength( unsigned curveIndex, float vStart,
 	}
 }
 
-void CurvesPrimitiveEvaluator::buildTree()
+namespace
 {
-	if( m_haveTree )
+
+// Batch queries are processed in runs of this size, so that the basis
+// coefficients for a whole run can be computed in a single tight loop
+// which the compiler is able to vectorise.
+const size_t g_batchSize = 64;
+
+} // namespace
+
+void CurvesPrimitiveEvaluator::pointsAtV( const std::vector<int> &curveIndices, const std::vector<float> &v, std::vector<V3f> &points, std::vector<V3f> *vTangents ) const
+{
+	if( curveIndices.size() != v.size() )
 	{
-		return;
+		throw InvalidArgumentException( "CurvesPrimitiveEvaluator::pointsAtV : curveIndices and v must have the same length" );
 	}
 
-	TreeMutex::scoped_lock lock( m_treeMutex );
+	points.resize( v.size() );
+	if( vTangents )
+	{
+		vTangents->resize( v.size() );
+	}
+
+	const CubicBasisf &basis = m_curvesPrimitive->basis();
+	const bool linear = basis == CubicBasisf::linear();
+	const bool periodic = m_curvesPrimitive->periodic();
+	const int numCoefficients = linear ? 2 : 4;
+	const int numCurves = m_verticesPerCurve.size();
+	const std::vector<V3f> &p = static_cast<const V3fVectorData *>( m_p.data.get() )->readable();
+
+	auto f = [&]( const tbb::blocked_range<size_t> &r )
+	{
+		float segmentV[g_batchSize];
+		unsigned indices[g_batchSize][4];
+		float c[4][g_batchSize];
+		float dc[4][g_batchSize];
+
+		for( size_t batchBegin = r.begin(); batchBegin < r.end(); batchBegin += g_batchSize )
+		{
+			const size_t batchSize = std::min( g_batchSize, r.end() - batchBegin );
+
+			// Find the segment and the vertices contributing to each query.
+			// This matches the logic in Result::init().
+
+			for( size_t i = 0; i < batchSize; ++i )
+			{
+				const int curveIndex = curveIndices[batchBegin+i];
+				const float queryV = v[batchBegin+i];
+				if( curveIndex < 0 || curveIndex >= numCurves || queryV < 0.0f || queryV > 1.0f )
+				{
+					throw InvalidArgumentException( boost::str( boost::format( "CurvesPrimitiveEvaluator::pointsAtV : Invalid query ( %d, %f )" ) % curveIndex % queryV ) );
+				}
+
+				const unsigned numVertices = m_verticesPerCurve[curveIndex];
+				unsigned numSegments = 0;
+				if( linear )
+				{
+					numSegments = periodic ? numVertices : numVertices - 1;
+				}
+				else
+				{
+					numSegments = periodic ? numVertices / basis.step : ( numVertices - 4 ) / basis.step + 1;
+				}
+
+				const float vv = queryV * numSegments;
+				const unsigned segment = min( (unsigned)fastFloatFloor( vv ), numSegments - 1 );
+				segmentV[i] = vv - segment;
+
+				const unsigned o = m_vertexDataOffsets[curveIndex];
+				const unsigned firstVertex = segment * basis.step;
+				for( int k = 0; k < numCoefficients; ++k )
+				{
+					indices[i][k] = periodic ? o + ( ( firstVertex + k ) % numVertices ) : o + firstVertex + k;
+				}
+			}
+
+			// Compute the coefficients for the whole batch.
+
+			if( linear )
+			{
+				for( size_t i = 0; i < batchSize; ++i )
+				{
+					c[0][i] = 1.0f - segmentV[i];
+					c[1][i] = segmentV[i];
+					dc[0][i] = 1.0f;
+					dc[1][i] = -1.0f;
+				}
+			}
+			else
+			{
+				for( size_t i = 0; i < batchSize; ++i )
+				{
+					basis.coefficients( segmentV[i], c[0][i], c[1][i], c[2][i], c[3][i] );
+				}
+				if( vTangents )
+				{
+					for( size_t i = 0; i < batchSize; ++i )
+					{
+						basis.derivativeCoefficients( segmentV[i], dc[0][i], dc[1][i], dc[2][i], dc[3][i] );
+					}
+				}
+			}
+
+			// And finally accumulate the results.
+
+			for( size_t i = 0; i < batchSize; ++i )
+			{
+				V3f point( 0 );
+				for( int k = 0; k < numCoefficients; ++k )
+				{
+					point += c[k][i] * p[indices[i][k]];
+				}
+				points[batchBegin+i] = point;
+			}
+
+			if( vTangents )
+			{
+				std::vector<V3f> &tangents = *vTangents;
+				for( size_t i = 0; i < batchSize; ++i )
+				{
+					V3f tangent( 0 );
+					for( int k = 0; k < numCoefficients; ++k )
+					{
+						tangent += dc[k][i] * p[indices[i][k]];
+					}
+					tangents[batchBegin+i] = tangent;
+				}
+			}
+		}
+	};
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for( tbb::blocked_range<size_t>( 0, v.size(), g_batchSize ), f, taskGroupContext );
+}
+
+bool CurvesPrimitiveEvaluator::closestPoints( const std::vector<V3f> &p, std::vector<int> &curveIndices, std::vector<float> &v ) const
+{
+	if( !m_verticesPerCurve.size() )
+	{
+		return false;
+	}
+
+	// See comments in closestPoint().
+	const_cast<CurvesPrimitiveEvaluator *>( this )->buildTree();
+
+	curveIndices.resize( p.size() );
+	v.resize( p.size() );
+
+	auto f = [&]( const tbb::blocked_range<size_t> &r )
+	{
+		for( size_t i = r.begin(); i != r.end(); ++i )
+		{
+			unsigned curveIndex = 0;
+			float closestV = -1;
+			float distSquared = Imath::limits<float>::max();
+			closestPointWalk( m_tree.rootIndex(), p[i], curveIndex, closestV, distSquared );
+			curveIndices[i] = curveIndex;
+			v[i] = closestV;
+		}
+	};
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for( tbb::blocked_range<size_t>( 0, p.size() ), f, taskGroupContext );
+
+	return true;
+}
+
+void CurvesPrimitiveEvaluator::buildTree()
+{
 	if( m_haveTree )
 	{
-		// another thread may have built the tree while we waited for the mutex
 		return;
 	}
 
-	bool linear = m_curvesPrimitive->basis() == CubicBasisf::linear();
+	// We generate the lines in parallel, without holding the mutex. If we
+	// held it, a thread waiting for our tasks to complete could steal an
+	// unrelated task which itself waits on the mutex, deadlocking. The cost
+	// is that concurrent first queries may generate the lines redundantly.
+
+	const bool linear = m_curvesPrimitive->basis() == CubicBasisf::linear();
 	const std::vector<V3f> &p = static_cast<const V3fVectorData *>( m_p.data.get() )->readable();
-	PrimitiveEvaluator::ResultPtr result = createResult();
+	const size_t numCurves = m_curvesPrimitive->numCurves();
 
-	size_t numCurves = m_curvesPrimitive->numCurves();
+	// Count the lines for each curve up front, so that each
+	// curve can then be processed independently.
+	std::vector<size_t> lineOffsets( numCurves + 1, 0 );
 	for( size_t curveIndex = 0; curveIndex<numCurves; curveIndex++ )
 	{
+		int numLines = 0;
 		if( linear )
 		{
-			int numVertices = m_verticesPerCurve[curveIndex];
-			int vertIndex = m_vertexDataOffsets[curveIndex];
-			float prevV = 0.0f;
-			for( int i=0; i<numVertices; i++, vertIndex++ )
+			numLines = m_verticesPerCurve[curveIndex] - 1;
+		}
+		else
+		{
+			numLines = m_curvesPrimitive->numSegments( curveIndex ) * Line::linesPerCurveSegment() - 1;
+		}
+		lineOffsets[curveIndex+1] = lineOffsets[curveIndex] + std::max( numLines, 0 );
+	}
+
+	std::vector<Box3f> treeBounds( lineOffsets.back() );
+	std::vector<Line> treeLines( lineOffsets.back() );
+
+	auto f = [&]( const tbb::blocked_range<size_t> &r )
+	{
+		PrimitiveEvaluator::ResultPtr result = createResult();
+		for( size_t curveIndex = r.begin(); curveIndex != r.end(); ++curveIndex )
+		{
+			size_t lineIndex = lineOffsets[curveIndex];
+			if( linear )
 			{
-				float v = clamp( (float)i/(float)(numVertices-1), 0.0f, 1.0f );
-				if( i!=0 )
+				int numVertices = m_verticesPerCurve[curveIndex];
+				int vertIndex = m_vertexDataOffsets[curveIndex];
+				float prevV = 0.0f;
+				for( int i=0; i<numVertices; i++, vertIndex++ )
 				{
-					Box3f b;
-					b.extendBy( p[vertIndex-1] );
-					b.extendBy( p[vertIndex] );
-					m_treeBounds.push_back( b );
-					m_treeLines.push_back( Line(  p[vertIndex-1], p[vertIndex], curveIndex, prevV, v ) );
+					float v = clamp( (float)i/(float)(numVertices-1), 0.0f, 1.0f );
+					if( i!=0 )
+					{
+						Box3f b;
+						b.extendBy( p[vertIndex-1] );
+						b.extendBy( p[vertIndex] );
+						treeBounds[lineIndex] = b;
+						treeLines[lineIndex++] = Line( p[vertIndex-1], p[vertIndex], curveIndex, prevV, v );
+					}
+					prevV = v;
 				}
-				prevV = v;
 			}
-		}
-		else
-		{
-			unsigned numSegments = m_curvesPrimitive->numSegments( curveIndex );
-			int steps = numSegments * Line::linesPerCurveSegment();
-			V3f prevP( 0 );
-			float prevV = 0;
-			for( int i=0; i<steps; i++ )
+			else
 			{
-				float v = clamp( (float)i/(float)(steps-1), 0.0f, 1.0f );
-				pointAtV( curveIndex, v, result.get() );
-				V3f p = result->point();
-				if( i!=0 )
+				unsigned numSegments = m_curvesPrimitive->numSegments( curveIndex );
+				int steps = numSegments * Line::linesPerCurveSegment();
+				V3f prevP( 0 );
+				float prevV = 0;
+				for( int i=0; i<steps; i++ )
 				{
-					Box3f b;
-					b.extendBy( prevP );
-					b.extendBy( p );
-					m_treeBounds.push_back( b );
-					m_treeLines.push_back( Line( prevP, p, curveIndex, prevV, v ) );
+					float v = clamp( (float)i/(float)(steps-1), 0.0f, 1.0f );
+					pointAtV( curveIndex, v, result.get() );
+					V3f p = result->point();
+					if( i!=0 )
+					{
+						Box3f b;
+						b.extendBy( prevP );
+						b.extendBy( p );
+						treeBounds[lineIndex] = b;
+						treeLines[lineIndex++] = Line( prevP, p, curveIndex, prevV, v );
+					}
+
+					prevP = p;
+					prevV = v;
 				}
-
-				prevP = p;
-				prevV = v;
 			}
+			assert( lineIndex == lineOffsets[curveIndex+1] );
 		}
+	};
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for( tbb::blocked_range<size_t>( 0, numCurves ), f, taskGroupContext );
+
+	TreeMutex::scoped_lock lock( m_treeMutex );
+	if( m_haveTree )
+	{
+		// another thread may have built the tree while we were generating lines
+		return;
 	}
 
+	m_treeBounds.swap( treeBounds );
+	m_treeLines.swap( treeLines );
 	m_tree.init( m_treeBounds.begin(), m_treeBounds.end() );
 	m_haveTree = true;
 }
@@ -193,6 +193,11 @@ struct FaceVaryingPromotionOp::Promoter
 
 };
 
+bool FaceVaryingPromotionOp::replacesModifiedMembers() const
+{
+	return true;
+}
+
 void FaceVaryingPromotionOp::modifyTypedPrimitive( MeshPrimitive *mesh, const CompoundObject *operands )
 {
 	const std::vector<std::string> &names = operands->member<StringVectorData>( "primVarNames" )->readable();
@@ -36,15 +36,19 @@
 
 #include "IECoreScene/Group.h"
 #include "IECoreScene/MatrixTransform.h"
-#include "IECoreScene/MeshMergeOp.h"
 #include "IECoreScene/MeshPrimitive.h"
 #include "IECoreScene/TransformOp.h"
 #include "IECoreScene/Triangulator.h"
 
 #include "IECore/BezierAlgo.h"
 #include "IECore/BoxOps.h"
+#include "IECore/Exception.h"
 #include "IECore/PolygonAlgo.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/concurrent_unordered_map.h"
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/parallel_for.h"
 #include "tbb/spin_mutex.h"
 
 #include "ft2build.h"
@@ -277,32 +281,97 @@ int Font::Mesher::cubicTo( const FT_Vector *control1, const FT_Vector *control2,
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-// Font::Implementation
+// Internal utilities
 ////////////////////////////////////////////////////////////////////////////////
 
-class Font::Implementation : public IECore::RefCounted
+namespace
 {
 
-	public :
+// Decodes UTF-8 text into Unicode code points. Bytes which aren't part
+// of a valid UTF-8 sequence are interpreted as Latin-1, so that existing
+// 8-bit text continues to work.
+void decodeUTF8( const std::string &text, std::vector<uint32_t> &codePoints )
+{
+	codePoints.reserve( codePoints.size() + text.size() );
 
-		Implementation( const std::string &fontFile )
-			:	m_fileName( fontFile ), m_kerning( 1.0f ), m_curveTolerance( 0.01 )
+	const unsigned char *c = reinterpret_cast<const unsigned char *>( text.c_str() );
+	const unsigned char *end = c + text.size();
+	while( c < end )
+	{
+		int length = 1;
+		uint32_t codePoint = *c;
+		if( ( *c & 0xE0 ) == 0xC0 )
 		{
-			FreeTypeMutex::scoped_lock lock( g_freeTypeMutex );
+			length = 2;
+			codePoint = *c & 0x1F;
+		}
+		else if( ( *c & 0xF0 ) == 0xE0 )
+		{
+			length = 3;
+			codePoint = *c & 0x0F;
+		}
+		else if( ( *c & 0xF8 ) == 0xF0 )
+		{
+			length = 4;
+			codePoint = *c & 0x07;
+		}
 
-			FT_Error e = FT_New_Face( library(), fontFile.c_str(), 0, &m_face );
-			if( e )
+		if( length > 1 )
+		{
+			bool valid = end - c >= length;
+			for( int i = 1; valid && i < length; ++i )
+			{
+				valid = ( c[i] & 0xC0 ) == 0x80;
+				codePoint = ( codePoint << 6 ) | ( c[i] & 0x3F );
+			}
+			if( !valid )
 			{
-				throw Exception( "Error creating new FreeType face." );
+				length = 1;
+				codePoint = *c;
 			}
+		}
+
+		codePoints.push_back( codePoint );
+		c += length;
+	}
+}
 
-			m_meshes.resize( 128 );
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// Font::Implementation
+////////////////////////////////////////////////////////////////////////////////
+
+class Font::Implementation : public IECore::RefCounted
+{
+
+	public :
+
+		Implementation( const std::string &fontFile )
+			:	m_fileName( fontFile ), m_kerning( 1.0f ), m_curveTolerance( 0.01 ), m_faces( FT_Face( nullptr ) )
+		{
+			// Create the face for this thread immediately, so that we throw
+			// if the file can't be loaded, and so we can query the metrics
+			// shared by all faces.
+			FT_Face f = face();
+			m_unitsPerEM = f->units_per_EM;
+			const float scale = 1.0f / (float)m_unitsPerEM;
+			m_bound = Box2f(
+				V2f( (float)f->bbox.xMin * scale, (float)f->bbox.yMin * scale ),
+				V2f( (float)f->bbox.xMax * scale, (float)f->bbox.yMax * scale )
+			);
 		}
 
 		~Implementation() override
 		{
 			FreeTypeMutex::scoped_lock lock( g_freeTypeMutex );
-			FT_Done_Face( m_face );
+			for( FT_Face f : m_faces )
+			{
+				if( f )
+				{
+					FT_Done_Face( f );
+				}
+			}
 		}
 
 		const std::string &fileName() const
@@ -331,137 +400,128 @@ class Font::Implementation : public IECore::RefCounted
 			return m_curveTolerance;
 		}
 
-		const MeshPrimitive *mesh( char c ) const
+		const MeshPrimitive *mesh( uint32_t codePoint ) const
 		{
-			return cachedMesh( c )->primitive.get();
+			return cachedMesh( codePoint )->primitive.get();
 		}
 
 		MeshPrimitivePtr mesh( const std::string &text ) const
 		{
-			MeshPrimitivePtr result = new MeshPrimitive;
-			V3fVectorDataPtr pData = new V3fVectorData;
-			pData->setInterpretation( GeometricData::Point );
-			result->variables["P"] = PrimitiveVariable( PrimitiveVariable::Vertex, pData );
+			return mesh( vector<string>( 1, text ), vector<V2f>( 1, V2f( 0 ) ) );
+		}
 
-			if( !text.size() )
+		MeshPrimitivePtr mesh( const std::vector<std::string> &texts, const std::vector<Imath::V2f> &origins ) const
+		{
+			if( texts.size() != origins.size() )
 			{
-				return result;
+				throw InvalidArgumentException( "Font::mesh : Number of texts and origins must match" );
 			}
 
-			MeshMergeOpPtr merger = new MeshMergeOp;
-			merger->inputParameter()->setValue( result );
-			merger->copyParameter()->setTypedValue( false );
-
-			TransformOpPtr transformOp = new TransformOp;
-			transformOp->copyParameter()->setTypedValue( false );
-			M44fDataPtr matrixData = new M44fData;
-			transformOp->matrixParameter()->setValue( matrixData );
-
-			for( unsigned i=0; i<text.size(); i++ )
+			vector<vector<uint32_t>> codePoints( texts.size() );
+			vector<uint32_t> uniqueCodePoints;
+			for( size_t i = 0; i < texts.size(); ++i )
 			{
-				const Mesh *character = cachedMesh( text[i] );
-
-				MeshPrimitivePtr primitive = character->primitive->copy();
-
-				transformOp->inputParameter()->setValue( primitive );
-				transformOp->operate();
+				decodeUTF8( texts[i], codePoints[i] );
+				uniqueCodePoints.insert( uniqueCodePoints.end(), codePoints[i].begin(), codePoints[i].end() );
+			}
 
-				merger->meshParameter()->setValue( primitive );
-				merger->operate();
+			std::sort( uniqueCodePoints.begin(), uniqueCodePoints.end() );
+			uniqueCodePoints.erase( std::unique( uniqueCodePoints.begin(), uniqueCodePoints.end() ), uniqueCodePoints.end() );
+
+			// Mesh all the glyphs in parallel up front, so that the
+			// layout below only needs to perform cache lookups.
+			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, uniqueCodePoints.size() ),
+				[this, &uniqueCodePoints]( const tbb::blocked_range<size_t> &range ) {
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						cachedMesh( uniqueCodePoints[i] );
+					}
+				},
+				taskGroupContext
+			);
 
-				if( i<text.size()-1 )
-				{
-					V2f a = advance( text[i], text[i+1] );
-					matrixData->writable().translate( V3f( a.x, a.y, 0 ) );
-				}
+			vector<PositionedGlyph> glyphs;
+			for( size_t i = 0; i < codePoints.size(); ++i )
+			{
+				layout( codePoints[i], origins[i], glyphs );
 			}
 
-			return result;
+			return merge( glyphs );
 		}
 
 		GroupPtr meshGroup( const std::string &text ) const
 		{
 			GroupPtr result = new Group;
 
-			if( !text.size() )
-			{
-				return result;
-			}
+			vector<uint32_t> codePoints;
+			decodeUTF8( text, codePoints );
 
-			M44f transform;
-			for( unsigned i=0; i<text.size(); i++ )
+			vector<PositionedGlyph> glyphs;
+			layout( codePoints, V2f( 0 ), glyphs );
+
+			for( const auto &glyph : glyphs )
 			{
-				const Mesh *character = cachedMesh( text[i] );
-				if( character->primitive->variableSize( PrimitiveVariable::Uniform ) )
+				if( glyph.mesh->primitive->variableSize( PrimitiveVariable::Uniform ) )
 				{
+					M44f transform;
+					transform.translate( V3f( glyph.origin.x, glyph.origin.y, 0 ) );
+
 					GroupPtr g = new Group;
-					g->addChild( character->primitive->copy() );
+					g->addChild( glyph.mesh->primitive->copy() );
 					g->setTransform( new MatrixTransform( transform ) );
 					result->addChild( g );
 				}
-
-				if( i<text.size()-1 )
-				{
-					V2f a = advance( text[i], text[i+1] );
-					transform.translate( V3f( a.x, a.y, 0 ) );
-				}
 			}
 
 			return result;
 		}
 
-		Imath::V2f advance( char first, char second ) const
+		Imath::V2f advance( uint32_t first, uint32_t second ) const
 		{
 			V2f a = cachedMesh( first )->advance;
 			if( m_kerning!=0.0f )
 			{
-				FreeTypeMutex::scoped_lock lock( g_freeTypeMutex );
-				FT_UInt left = FT_Get_Char_Index( m_face, first );
-				FT_UInt right = FT_Get_Char_Index( m_face, second );
+				FT_Face f = face();
+				FT_UInt left = FT_Get_Char_Index( f, first );
+				FT_UInt right = FT_Get_Char_Index( f, second );
 				FT_Vector kerning;
-				FT_Error e = FT_Get_Kerning( m_face, left, right, FT_KERNING_UNSCALED, &kerning );
+				FT_Error e = FT_Get_Kerning( f, left, right, FT_KERNING_UNSCALED, &kerning );
 				if( !e )
 				{
-					a += m_kerning * V2f( kerning.x, kerning.y ) / m_face->units_per_EM;
+					a += m_kerning * V2f( kerning.x, kerning.y ) / m_unitsPerEM;
 				}
 			}
 			return a;
 		}
 
-
 		Imath::Box2f bound() const
 		{
-			float scale = 1.0f / (float)(m_face->units_per_EM);
-			return Box2f(
-				V2f( (float)m_face->bbox.xMin * scale, (float)m_face->bbox.yMin * scale ),
-				V2f( (float)m_face->bbox.xMax * scale, (float)m_face->bbox.yMax * scale )
-			);
+			return m_bound;
 		}
 
-		Imath::Box2f bound( char c ) const
+		Imath::Box2f bound( uint32_t codePoint ) const
 		{
-			Imath::Box3f b = cachedMesh( c )->bound;
+			Imath::Box3f b = cachedMesh( codePoint )->bound;
 			return Imath::Box2f( Imath::V2f( b.min.x, b.min.y ), Imath::V2f( b.max.x, b.max.y ) );
 		}
 
 		Imath::Box2f bound( const std::string &text ) const
 		{
-			Imath::Box2f result;
-			if( !text.size() )
-			{
-				return result;
-			}
+			vector<uint32_t> codePoints;
+			decodeUTF8( text, codePoints );
 
-			V2f translate( 0 );
-			for( unsigned i=0; i<text.size(); i++ )
+			vector<PositionedGlyph> glyphs;
+			layout( codePoints, V2f( 0 ), glyphs );
+
+			Imath::Box2f result;
+			for( const auto &glyph : glyphs )
 			{
-				Box2f b = bound( text[i] );
-				b.min += translate;
-				b.max += translate;
-				result.extendBy( b );
-				if( i<text.size()-1 )
+				const Box3f &b = glyph.mesh->bound;
+				if( !b.isEmpty() )
 				{
-					translate += advance( text[i], text[i+1] );
+					result.extendBy( Box2f( V2f( b.min.x, b.min.y ) + glyph.origin, V2f( b.max.x, b.max.y ) + glyph.origin ) );
 				}
 			}
 
@@ -472,10 +532,35 @@ class Font::Implementation : public IECore::RefCounted
 
 		std::string m_fileName;
 
-		FT_Face m_face;
 		float m_kerning;
 		float m_curveTolerance;
 
+		FT_UShort m_unitsPerEM;
+		Box2f m_bound;
+
+		// FreeType faces may not be used concurrently, so we give each
+		// thread a face of its own. This allows glyphs to be loaded and
+		// meshed in parallel, with only the creation and destruction of
+		// faces serialised, since they share a single FT_Library.
+		mutable tbb::enumerable_thread_specific<FT_Face> m_faces;
+
+		FT_Face face() const
+		{
+			FT_Face &f = m_faces.local();
+			if( !f )
+			{
+				FreeTypeMutex::scoped_lock lock( g_freeTypeMutex );
+				FT_Face newFace = nullptr;
+				FT_Error e = FT_New_Face( library(), m_fileName.c_str(), 0, &newFace );
+				if( e )
+				{
+					throw Exception( "Error creating new FreeType face." );
+				}
+				f = newFace;
+			}
+			return f;
+		}
+
 		struct Mesh
 		{
 			ConstMeshPrimitivePtr primitive;
@@ -485,42 +570,167 @@ class Font::Implementation : public IECore::RefCounted
 
 		typedef boost::shared_ptr<Mesh> MeshPtr;
 		typedef boost::shared_ptr<const Mesh> ConstMeshPtr;
-		mutable std::vector<MeshPtr> m_meshes;
+		typedef tbb::concurrent_unordered_map<uint32_t, ConstMeshPtr> MeshMap;
+		mutable MeshMap m_meshes;
 
-		const Mesh *cachedMesh( char c ) const
+		const Mesh *cachedMesh( uint32_t codePoint ) const
 		{
-			FreeTypeMutex::scoped_lock lock( g_freeTypeMutex );
-
 			// see if we have it cached
-			if( m_meshes[c] )
+			MeshMap::const_iterator it = m_meshes.find( codePoint );
+			if( it != m_meshes.end() )
 			{
-				return m_meshes[c].get();
+				return it->second.get();
 			}
 
-			// not in cache, so load it
-			FT_Load_Char( m_face, c, FT_LOAD_NO_BITMAP | FT_LOAD_NO_SCALE );
+			// not in cache, so load it using the face for this thread
+			FT_Face f = face();
+			FT_Load_Char( f, codePoint, FT_LOAD_NO_BITMAP | FT_LOAD_NO_SCALE );
 
 			// get the mesh
-			Mesher m( (FT_Pos)(m_curveTolerance * m_face->units_per_EM) );
-			MeshPrimitivePtr primitive = m.mesh( &(m_face->glyph->outline) );
+			Mesher m( (FT_Pos)(m_curveTolerance * m_unitsPerEM) );
+			MeshPrimitivePtr primitive = m.mesh( &(f->glyph->outline) );
 
 			// transform it so an EM is 1 unit
-			M44f transform; transform.scale( V3f( 1.0f / m_face->units_per_EM ) );
+			M44f transform; transform.scale( V3f( 1.0f / m_unitsPerEM ) );
 			TransformOpPtr transformOp = new TransformOp;
 			transformOp->inputParameter()->setValue( primitive );
 			transformOp->matrixParameter()->setValue( new M44fData( transform ) );
 			transformOp->copyParameter()->setTypedValue( false );
 			transformOp->operate();
 
-			// put it in the cache
 			MeshPtr mesh( new Mesh );
 			mesh->primitive = primitive;
 			mesh->bound = primitive->bound();
-			mesh->advance = V2f( m_face->glyph->advance.x, m_face->glyph->advance.y ) / m_face->units_per_EM;
-			m_meshes[c] = mesh;
+			mesh->advance = V2f( f->glyph->advance.x, f->glyph->advance.y ) / m_unitsPerEM;
+
+			// put it in the cache. if another thread got there first
+			// we return its mesh instead, so that all callers share
+			// the same one.
+			return m_meshes.insert( MeshMap::value_type( codePoint, mesh ) ).first->second.get();
+		}
+
+		struct PositionedGlyph
+		{
+			const Mesh *mesh;
+			V2f origin;
+		};
+
+		// Appends the glyphs for a single line of text to `glyphs`,
+		// starting at `origin` and taking into account the current
+		// kerning.
+		void layout( const vector<uint32_t> &codePoints, V2f origin, vector<PositionedGlyph> &glyphs ) const
+		{
+			glyphs.reserve( glyphs.size() + codePoints.size() );
+			for( size_t i = 0; i < codePoints.size(); ++i )
+			{
+				glyphs.push_back( { cachedMesh( codePoints[i] ), origin } );
+				if( i < codePoints.size() - 1 )
+				{
+					origin += advance( codePoints[i], codePoints[i+1] );
+				}
+			}
+		}
 
-			// return it
-			return mesh.get();
+		// Merges the glyphs into a single mesh. This is equivalent to
+		// using MeshMergeOp and TransformOp on each glyph in turn, merging
+		// the "P" and "N" primitive variables, but avoids repeatedly
+		// reallocating the result, and copies the glyphs in parallel.
+		static MeshPrimitivePtr merge( const vector<PositionedGlyph> &glyphs )
+		{
+			struct Offsets
+			{
+				size_t faces;
+				size_t vertexIds;
+				size_t points;
+			};
+
+			vector<Offsets> offsets;
+			offsets.reserve( glyphs.size() );
+			Offsets total = { 0, 0, 0 };
+			bool hasNormals = false;
+			for( const auto &glyph : glyphs )
+			{
+				offsets.push_back( total );
+				const MeshPrimitive *primitive = glyph.mesh->primitive.get();
+				total.faces += primitive->verticesPerFace()->readable().size();
+				total.vertexIds += primitive->vertexIds()->readable().size();
+				total.points += primitive->variableSize( PrimitiveVariable::Vertex );
+				hasNormals = hasNormals || primitive->variableData<V3fVectorData>( "N", PrimitiveVariable::Varying );
+			}
+
+			IntVectorDataPtr verticesPerFaceData = new IntVectorData;
+			vector<int> &verticesPerFace = verticesPerFaceData->writable();
+			verticesPerFace.resize( total.faces );
+
+			IntVectorDataPtr vertexIdsData = new IntVectorData;
+			vector<int> &vertexIds = vertexIdsData->writable();
+			vertexIds.resize( total.vertexIds );
+
+			V3fVectorDataPtr pData = new V3fVectorData;
+			pData->setInterpretation( GeometricData::Point );
+			vector<V3f> &p = pData->writable();
+			p.resize( total.points );
+
+			// As in MeshMergeOp, glyphs without normals get zero normals.
+			V3fVectorDataPtr nData;
+			vector<V3f> *n = nullptr;
+			if( hasNormals )
+			{
+				nData = new V3fVectorData;
+				nData->setInterpretation( GeometricData::Normal );
+				n = &nData->writable();
+				n->resize( total.points, V3f( 0 ) );
+			}
+
+			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, glyphs.size() ),
+				[&]( const tbb::blocked_range<size_t> &range ) {
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						const MeshPrimitive *primitive = glyphs[i].mesh->primitive.get();
+						const Offsets &o = offsets[i];
+
+						const vector<int> &glyphVerticesPerFace = primitive->verticesPerFace()->readable();
+						std::copy( glyphVerticesPerFace.begin(), glyphVerticesPerFace.end(), verticesPerFace.begin() + o.faces );
+
+						const vector<int> &glyphVertexIds = primitive->vertexIds()->readable();
+						for( size_t j = 0, e = glyphVertexIds.size(); j < e; ++j )
+						{
+							vertexIds[o.vertexIds + j] = glyphVertexIds[j] + o.points;
+						}
+
+						if( const V3fVectorData *glyphPData = primitive->variableData<V3fVectorData>( "P" ) )
+						{
+							const V3f translation( glyphs[i].origin.x, glyphs[i].origin.y, 0 );
+							const vector<V3f> &glyphP = glyphPData->readable();
+							for( size_t j = 0, e = glyphP.size(); j < e; ++j )
+							{
+								p[o.points + j] = glyphP[j] + translation;
+							}
+						}
+
+						if( n )
+						{
+							if( const V3fVectorData *glyphNData = primitive->variableData<V3fVectorData>( "N", PrimitiveVariable::Varying ) )
+							{
+								const vector<V3f> &glyphN = glyphNData->readable();
+								std::copy( glyphN.begin(), glyphN.end(), n->begin() + o.points );
+							}
+						}
+					}
+				},
+				taskGroupContext
+			);
+
+			MeshPrimitivePtr result = new MeshPrimitive;
+			result->setTopology( verticesPerFaceData, vertexIdsData );
+			result->variables["P"] = PrimitiveVariable( PrimitiveVariable::Vertex, pData );
+			if( nData )
+			{
+				result->variables["N"] = PrimitiveVariable( PrimitiveVariable::Varying, nData );
+			}
+			return result;
 		}
 
 		typedef tbb::spin_mutex FreeTypeMutex;
@@ -586,7 +796,7 @@ float Font::getCurveTolerance() const
 
 const MeshPrimitive *Font::mesh( char c ) const
 {
-	return m_implementation->mesh( c );
+	return m_implementation->mesh( (unsigned char)c );
 }
 
 MeshPrimitivePtr Font::mesh( const std::string &text ) const
@@ -594,6 +804,11 @@ MeshPrimitivePtr Font::mesh( const std::string &text ) const
 	return m_implementation->mesh( text );
 }
 
+MeshPrimitivePtr Font::mesh( const std::vector<std::string> &texts, const std::vector<Imath::V2f> &origins ) const
+{
+	return m_implementation->mesh( texts, origins );
+}
+
 GroupPtr Font::meshGroup( const std::string &text ) const
 {
 	return m_implementation->meshGroup( text );
@@ -601,7 +816,7 @@ GroupPtr Font::meshGroup( const std::string &text ) const
 
 Imath::V2f Font::advance( char first, char second ) const
 {
-	return m_implementation->advance( first, second );
+	return m_implementation->advance( (unsigned char)first, (unsigned char)second );
 }
 
 Imath::Box2f Font::bound() const
@@ -611,7 +826,7 @@ Imath::Box2f Font::bound() const
 
 Imath::Box2f Font::bound( char c ) const
 {
-	return m_implementation->bound( c );
+	return m_implementation->bound( (unsigned char)c );
 }
 
 Imath::Box2f Font::bound( const std::string &text ) const
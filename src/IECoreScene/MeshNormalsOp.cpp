@@ -203,6 +203,11 @@ struct MeshNormalsOp::HandleErrors
 	}
 };
 
+bool MeshNormalsOp::replacesModifiedMembers() const
+{
+	return true;
+}
+
 void MeshNormalsOp::modifyTypedPrimitive( MeshPrimitive * mesh, const CompoundObject * operands )
 {
 	const std::string &pPrimVarName = pPrimVarNameParameter()->getTypedValue();
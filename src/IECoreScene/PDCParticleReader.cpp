@@ -35,6 +35,7 @@
 #include "IECoreScene/PDCParticleReader.h"
 
 #include "IECoreScene/ParticleReader.inl"
+#include "IECoreScene/private/PDCParticleUtils.h"
 
 #include "IECore/ByteOrder.h"
 #include "IECore/FileNameParameter.h"
@@ -43,8 +44,11 @@
 #include "IECore/Timer.h"
 #include "IECore/VectorTypedData.h"
 
+#include "boost/iostreams/device/mapped_file.hpp"
+
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <fstream>
 
 using namespace IECore;
@@ -55,22 +59,26 @@ using namespace std;
 
 IE_CORE_DEFINERUNTIMETYPED( PDCParticleReader );
 
+struct PDCParticleReader::MappedFile
+{
+	boost::iostreams::mapped_file_source source;
+};
+
 const Reader::ReaderDescription<PDCParticleReader> PDCParticleReader::m_readerDescription( "pdc" );
 
 PDCParticleReader::PDCParticleReader( )
-	:	ParticleReader( "Reads Maya .pdc format particle caches" ), m_iStream( nullptr ), m_idAttribute( nullptr )
+	:	ParticleReader( "Reads Maya .pdc format particle caches" ), m_idAttribute( nullptr )
 {
 }
 
 PDCParticleReader::PDCParticleReader( const std::string &fileName )
-	:	ParticleReader( "Reads Maya .pdc format particle caches" ), m_iStream( nullptr ), m_idAttribute( nullptr )
+	:	ParticleReader( "Reads Maya .pdc format particle caches" ), m_idAttribute( nullptr )
 {
 	m_fileNameParameter->setTypedValue( fileName );
 }
 
 PDCParticleReader::~PDCParticleReader()
 {
-	delete m_iStream;
 }
 
 bool PDCParticleReader::canRead( const std::string &fileName )
@@ -91,35 +99,59 @@ bool PDCParticleReader::canRead( const std::string &fileName )
 
 bool PDCParticleReader::open()
 {
-	if( !m_iStream || m_streamFileName!=fileName() )
+	if( !m_file || m_streamFileName!=fileName() )
 	{
-		delete m_iStream;
-		m_iStream = new ifstream( fileName().c_str() );
-		if( !m_iStream->is_open() || !m_iStream->good() )
+		m_file.reset();
+		m_header.valid = false;
+		m_header.attributes.clear();
+		m_idAttribute = nullptr;
+
+		std::unique_ptr<MappedFile> file( new MappedFile );
+		try
+		{
+			file->source.open( fileName() );
+		}
+		catch( const std::exception &)
 		{
 			return false;
 		}
-
-		char pdc[4];
-		m_iStream->read( pdc, 4 );
-		if( strncmp( "PDC ", pdc, 4 ) )
+		if( !file->source.is_open() )
 		{
-			m_header.valid = false;
 			return false;
 		}
 
-		m_iStream->read( (char *)&m_header.version, sizeof( m_header.version ) );
+		const char *data = file->source.data();
+		const size_t size = file->source.size();
+		size_t offset = 0;
+
+		// Reads an int from the header, returning false if
+		// it would take us past the end of the file.
+		auto readInt = [&]( int &v ) -> bool {
+			if( offset + sizeof( int ) > size )
+			{
+				return false;
+			}
+			memcpy( &v, data + offset, sizeof( int ) );
+			offset += sizeof( int );
+			return true;
+		};
 
-		int endian = 0;
-		m_iStream->read( (char *)&endian, sizeof( endian ) );
-		if( endian!=1 )
+		if( size < 4 || strncmp( "PDC ", data, 4 ) )
 		{
-			m_header.reverseBytes = true;
-			m_header.version = reverseBytes( m_header.version );
+			return false;
 		}
-		else
+		offset = 4;
+
+		int endian = 0, unused = 0, numAttributes = 0;
+		if( !readInt( m_header.version ) || !readInt( endian ) || !readInt( unused ) || !readInt( unused ) )
+		{
+			return false;
+		}
+
+		m_header.reverseBytes = endian!=1;
+		if( m_header.reverseBytes )
 		{
-			m_header.reverseBytes = false;
+			m_header.version = reverseBytes( m_header.version );
 		}
 
 		if( m_header.version > 1 )
@@ -127,85 +159,94 @@ bool PDCParticleReader::open()
 			msg( Msg::Warning, "PDCParticleReader::open()", format( "File \"%s\" has unknown version %d." ) % fileName() % m_header.version );
 		}
 
-		int unused = 0;
-		m_iStream->read( (char *)&unused, sizeof( unused ) );
-		m_iStream->read( (char *)&unused, sizeof( unused ) );
-
-		m_iStream->read( (char *)&m_header.numParticles, sizeof( m_header.numParticles ) );
-		if( m_header.reverseBytes )
+		if( !readInt( m_header.numParticles ) || !readInt( numAttributes ) )
 		{
-			m_header.numParticles = reverseBytes( m_header.numParticles );
+			return false;
 		}
-
-		int numAttributes;
-		m_iStream->read( (char *)&numAttributes, sizeof( numAttributes ) );
 		if( m_header.reverseBytes )
 		{
+			m_header.numParticles = reverseBytes( m_header.numParticles );
 			numAttributes = reverseBytes( numAttributes );
 		}
+		if( m_header.numParticles < 0 )
+		{
+			return false;
+		}
+
 		for( int i=0; i<numAttributes; i++ )
 		{
 			int nameLength;
-			m_iStream->read( (char *)&nameLength, sizeof( nameLength ) );
+			if( !readInt( nameLength ) )
+			{
+				return false;
+			}
 			if( m_header.reverseBytes )
 			{
 				nameLength = reverseBytes( nameLength );
 			}
-			string attrName; char c;
-			for( int j=0; j<nameLength; j++ )
+			if( nameLength < 0 || offset + nameLength > size )
 			{
-				m_iStream->read( &c, 1 );
-				attrName += c;
+				return false;
 			}
+			string attrName( data + offset, nameLength );
+			offset += nameLength;
 			if( attrName=="ghostFrames" )
 			{
 				// alias' own pdc files don't match their own spec.
 				// they have a junk attributes on the end with no
 				// type and no data. it's called ghostframes and
-				// we need to skip it to prevent our stream from
-				// going bad.
+				// we need to skip it.
 				assert( i==numAttributes-1 ); // we're assuming the bad attribute is always the last one
 				continue;
 			}
 			Record r;
-			m_iStream->read( (char *)&r.type, sizeof( r.type ) );
+			if( !readInt( r.type ) )
+			{
+				return false;
+			}
 			if( m_header.reverseBytes )
 			{
 				r.type = reverseBytes( r.type );
 			}
-			r.position = m_iStream->tellg();
+			r.offset = offset;
 			m_header.attributes[attrName] = r;
+			const size_t numParticles = m_header.numParticles;
 			switch( r.type )
 			{
 				case Integer :
-					m_iStream->seekg( sizeof( int ), ios_base::cur );
+					offset += sizeof( int );
 					break;
 				case IntegerArray :
-					m_iStream->seekg( sizeof( int ) * m_header.numParticles, ios_base::cur );
+					offset += sizeof( int ) * numParticles;
 					break;
 				case Double :
-					m_iStream->seekg( sizeof( double ), ios_base::cur );
+					offset += sizeof( double );
 					break;
 				case DoubleArray :
-					m_iStream->seekg( sizeof( double ) * m_header.numParticles, ios_base::cur );
+					offset += sizeof( double ) * numParticles;
 					break;
 				case Vector :
-					m_iStream->seekg( sizeof( double ) * 3, ios_base::cur );
+					offset += sizeof( double ) * 3;
 					break;
 				case VectorArray :
-					m_iStream->seekg( sizeof( double ) * 3 * m_header.numParticles, ios_base::cur );
+					offset += sizeof( double ) * 3 * numParticles;
 					break;
 				default :
 					assert( r.type < 6 ); // unknown type
 			}
-
+			if( offset > size )
+			{
+				// Truncated file - don't allow reads past the
+				// end of the mapping.
+				return false;
+			}
 		}
 
-		m_header.valid = m_iStream->good();
+		m_file = std::move( file );
+		m_header.valid = true;
 		m_streamFileName = fileName();
-		m_idAttribute = nullptr;
 	}
-	return m_iStream->good() && m_header.valid;
+	return m_header.valid;
 }
 
 unsigned long PDCParticleReader::numParticles()
@@ -231,19 +272,32 @@ void PDCParticleReader::attributeNames( std::vector<std::string> &names )
 }
 
 template<typename T>
-void PDCParticleReader::readElements( T *buffer, std::streampos pos, unsigned long n ) const
+void PDCParticleReader::readElements( T *buffer, size_t offset, unsigned long n ) const
 {
-	m_iStream->seekg( pos );
-	m_iStream->read( (char *)buffer, n * sizeof( T ) );
+	assert( offset + n * sizeof( T ) <= m_file->source.size() );
+	memcpy( buffer, m_file->source.data() + offset, n * sizeof( T ) );
 	if( m_header.reverseBytes )
 	{
-		for( unsigned long i=0; i<n; i++ )
+		reverseBytes( buffer, buffer, n );
+	}
+}
+
+template<typename T, typename F>
+void PDCParticleReader::readConvertedElements( T *buffer, size_t offset, unsigned long n ) const
+{
+	F block[Detail::g_pdcConversionBlockSize];
+	while( n )
+	{
+		const size_t blockSize = std::min( (size_t)n, Detail::g_pdcConversionBlockSize );
+		readElements( block, offset, blockSize );
+		for( size_t i = 0; i < blockSize; ++i )
 		{
-			*buffer = reverseBytes( *buffer );
-			buffer++;
+			buffer[i] = static_cast<T>( block[i] );
 		}
+		buffer += blockSize;
+		offset += blockSize * sizeof( F );
+		n -= blockSize;
 	}
-	assert( m_iStream->good() );
 }
 
 DataPtr PDCParticleReader::readAttribute( const std::string &name )
@@ -271,7 +325,7 @@ DataPtr PDCParticleReader::readAttribute( const std::string &name )
 		case Integer :
 			{
 				IntDataPtr d( new IntData );
-				readElements( &d->writable(), it->second.position, 1 );
+				readElements( &d->writable(), it->second.offset, 1 );
 				result = d;
 			}
 			break;
@@ -279,14 +333,14 @@ DataPtr PDCParticleReader::readAttribute( const std::string &name )
 			{
 				IntVectorDataPtr d( new IntVectorData );
 				d->writable().resize( numParticles() );
-				readElements( &d->writable()[0], it->second.position, numParticles() );
+				readElements( d->writable().data(), it->second.offset, numParticles() );
 				result = filterAttr<IntVectorData, IntVectorData>( d.get(), particlePercentage(), idAttr );
 			}
 			break;
 		case Double :
 			{
 				DoubleDataPtr d( new DoubleData );
-				readElements( &d->writable(), it->second.position, 1 );
+				readElements( &d->writable(), it->second.offset, 1 );
 				switch( realType() )
 				{
 					case Native :
@@ -301,9 +355,19 @@ DataPtr PDCParticleReader::readAttribute( const std::string &name )
 			break;
 		case DoubleArray :
 			{
+				if( realType() == Float && particlePercentage() >= 100.0f )
+				{
+					// No filtering needed, so we can convert directly
+					// into the result.
+					FloatVectorDataPtr f( new FloatVectorData );
+					f->writable().resize( numParticles() );
+					readConvertedElements<float, double>( f->writable().data(), it->second.offset, numParticles() );
+					result = f;
+					break;
+				}
 				DoubleVectorDataPtr d( new DoubleVectorData );
 				d->writable().resize( numParticles() );
-				readElements( &d->writable()[0], it->second.position, numParticles() );
+				readElements( d->writable().data(), it->second.offset, numParticles() );
 				switch( realType() )
 				{
 					case Native :
@@ -319,7 +383,7 @@ DataPtr PDCParticleReader::readAttribute( const std::string &name )
 		case Vector :
 			{
 				V3dDataPtr d( new V3dData );
-				readElements( (double *)&d->writable(), it->second.position, 3 );
+				readElements( (double *)&d->writable(), it->second.offset, 3 );
 				switch( realType() )
 				{
 					case Native :
@@ -334,6 +398,14 @@ DataPtr PDCParticleReader::readAttribute( const std::string &name )
 			break;
 		case VectorArray :
 			{
+				if( realType() == Float && particlePercentage() >= 100.0f )
+				{
+					V3fVectorDataPtr f( new V3fVectorData );
+					f->writable().resize( numParticles() );
+					readConvertedElements<float, double>( (float *)f->writable().data(), it->second.offset, numParticles() * 3 );
+					result = f;
+					break;
+				}
 				V3dVectorDataPtr d( new V3dVectorData );
 				/// \todo
 				/// by all accounts the line below should be this :
@@ -350,7 +422,7 @@ DataPtr PDCParticleReader::readAttribute( const std::string &name )
 				/// this resize problem only occurs with V3d, and not with V3f, or double, or even
 				/// a struct with 3 doubles in, or even a template struct with 3 doubles in.
 				d->writable().resize( numParticles(), V3d( 0 ) );
-				readElements( (double *)&d->writable()[0], it->second.position, numParticles() * 3 );
+				readElements( (double *)d->writable().data(), it->second.offset, numParticles() * 3 );
 				switch( realType() )
 				{
 					case Native :
@@ -390,14 +462,14 @@ const Data * PDCParticleReader::idAttribute()
 			{
 				DoubleVectorDataPtr doubleVec = new DoubleVectorData;
 				doubleVec->writable().resize( numParticles() );
-				readElements( &doubleVec->writable()[0], it->second.position, numParticles() );
+				readElements( doubleVec->writable().data(), it->second.offset, numParticles() );
 				m_idAttribute = doubleVec;
 			}
 			if( it->second.type==IntegerArray )
 			{
 				IntVectorDataPtr intVec = new IntVectorData;
 				intVec->writable().resize( numParticles() );
-				readElements( &intVec->writable()[0], it->second.position, numParticles() );
+				readElements( intVec->writable().data(), it->second.offset, numParticles() );
 				m_idAttribute = intVec;
 			}
 		}
@@ -35,16 +35,19 @@
 #include "IECoreScene/PDCParticleWriter.h"
 
 #include "IECoreScene/PointsPrimitive.h"
+#include "IECoreScene/private/PDCParticleUtils.h"
 
 #include "IECore/ByteOrder.h"
-#include "IECore/DataCastOp.h"
 #include "IECore/FileNameParameter.h"
 #include "IECore/MessageHandler.h"
+#include "IECore/SimpleTypedData.h"
 #include "IECore/VectorTypedData.h"
 
 #include "boost/format.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <type_traits>
 
 using namespace IECore;
 using namespace IECoreScene;
@@ -67,48 +70,47 @@ PDCParticleWriter::PDCParticleWriter( ObjectPtr object, const std::string &fileN
 	m_fileNameParameter->setTypedValue( fileName );
 }
 
-template<class T, class E, unsigned int n>
-static void writeAttr( ofstream &oStream, const T *attr )
+namespace
 {
-	if( bigEndian() )
+
+// Writes n elements of type F as big endian elements of type E.
+// Conversion is performed in fixed size blocks, so we never need
+// to hold a converted copy of an entire attribute in memory.
+template<typename E, typename F>
+void writeElements( ofstream &oStream, const F *data, size_t n )
+{
+	if( bigEndian() && std::is_same<E, F>::value )
 	{
-		const typename T::ValueType &v = attr->readable();
-		oStream.write( (const char *)&v[0], sizeof( E ) * n * v.size() );
+		oStream.write( (const char *)data, sizeof( E ) * n );
+		return;
 	}
-	else
+
+	E block[Detail::g_pdcConversionBlockSize];
+	while( n )
 	{
-		typename T::Ptr attrCopy = attr->copy();
-		typename T::ValueType &v = attrCopy->writable();
-		E *data = (E *)&v[0];
-		for( size_t i=0; i<v.size() * n; i++ )
+		const size_t blockSize = std::min( n, Detail::g_pdcConversionBlockSize );
+		for( size_t i = 0; i < blockSize; ++i )
+		{
+			block[i] = static_cast<E>( data[i] );
+		}
+		if( !bigEndian() )
 		{
-			*data = reverseBytes( *data );
-			data++;
+			reverseBytes( block, block, blockSize );
 		}
-		oStream.write( (const char *)&v[0], sizeof( E ) * n * v.size() );
+		oStream.write( (const char *)block, sizeof( E ) * blockSize );
+		data += blockSize;
+		n -= blockSize;
 	}
 }
 
-template<class T, class E, unsigned int n>
-static void writeSimpleAttr( ofstream &oStream, const T *attr )
+void writeType( ofstream &oStream, int type )
 {
-	if( bigEndian() )
-	{
-		oStream.write( (const char *)&attr->readable(), sizeof( E ) * n );
-	}
-	else
-	{
-		typename T::ValueType v = attr->readable();
-		E *data = (E *)&v;
-		for( size_t i=0; i<n; i++ )
-		{
-			*data = reverseBytes( *data );
-			data++;
-		}
-		oStream.write( (const char *)&v, sizeof( E ) * n );
-	}
+	type = asBigEndian( type );
+	oStream.write( (const char *)&type, sizeof( type ) );
 }
 
+} // namespace
+
 void PDCParticleWriter::doWrite( const CompoundObject *operands )
 {
 	// write the header
@@ -158,8 +160,8 @@ void PDCParticleWriter::doWrite( const CompoundObject *operands )
 		}
 	}
 
-	// write out the attributes
-	DataCastOp castOp;
+	// write out the attributes. PDCs don't handle floats, so float
+	// attributes are converted to doubles as they are written.
 	int numAttrs = checkedAttrNames.size();
 	int numAttrsReversed = asBigEndian( numAttrs );
 	oStream.write( (const char *)&numAttrsReversed, sizeof( numAttrsReversed ) );
@@ -170,86 +172,74 @@ void PDCParticleWriter::doWrite( const CompoundObject *operands )
 		oStream.write( (const char *)&nameLengthReversed, sizeof( nameLengthReversed ) );
 		oStream.write( it->c_str(), nameLength );
 
-		DataPtr attr = pv.find( *it )->second.data;
+		const Data *attr = pv.find( *it )->second.data.get();
 		switch( attr->typeId() )
 		{
 			case IntVectorDataTypeId :
 				{
-					int type = 1; type = asBigEndian( type );
-					oStream.write( (const char *)&type, sizeof( type ) );
-					IntVectorDataPtr d = boost::static_pointer_cast<IntVectorData>( attr );
-					writeAttr<IntVectorData, int, 1>( oStream, d.get() );
+					writeType( oStream, 1 );
+					const vector<int> &v = static_cast<const IntVectorData *>( attr )->readable();
+					writeElements<int>( oStream, v.data(), v.size() );
 				}
 				break;
-			// casting FloatVectorData to DoubleVectorData since PDCs don't handle floats
 			case FloatVectorDataTypeId :
 				{
-					castOp.objectParameter()->setValue( attr );
-					castOp.targetTypeParameter()->setNumericValue( DoubleVectorDataTypeId );
-					attr = boost::static_pointer_cast<DoubleVectorData>( castOp.operate() );
-				} // intentionally falling through
+					writeType( oStream, 3 );
+					const vector<float> &v = static_cast<const FloatVectorData *>( attr )->readable();
+					writeElements<double>( oStream, v.data(), v.size() );
+				}
+				break;
 			case DoubleVectorDataTypeId :
 				{
-					int type = 3; type = asBigEndian( type );
-					oStream.write( (const char *)&type, sizeof( type ) );
-					DoubleVectorDataPtr d = boost::static_pointer_cast<DoubleVectorData>( attr );
-					writeAttr<DoubleVectorData, double, 1>( oStream, d.get() );
+					writeType( oStream, 3 );
+					const vector<double> &v = static_cast<const DoubleVectorData *>( attr )->readable();
+					writeElements<double>( oStream, v.data(), v.size() );
 				}
 				break;
-			// casting V3fVectorData and Color3fVectorData to V3dVectorData since PDCs don't handle floats
 			case V3fVectorDataTypeId :
+				{
+					writeType( oStream, 5 );
+					const vector<Imath::V3f> &v = static_cast<const V3fVectorData *>( attr )->readable();
+					writeElements<double>( oStream, (const float *)v.data(), v.size() * 3 );
+				}
+				break;
 			case Color3fVectorDataTypeId :
 				{
-					castOp.objectParameter()->setValue( attr );
-					castOp.targetTypeParameter()->setNumericValue( V3dVectorDataTypeId );
-					attr = boost::static_pointer_cast<V3dVectorData>( castOp.operate() );
-				} // intentionally falling through
+					writeType( oStream, 5 );
+					const vector<Imath::Color3f> &v = static_cast<const Color3fVectorData *>( attr )->readable();
+					writeElements<double>( oStream, (const float *)v.data(), v.size() * 3 );
+				}
+				break;
 			case V3dVectorDataTypeId :
 				{
-					int type = 5; type = asBigEndian( type );
-					oStream.write( (const char *)&type, sizeof( type ) );
-					V3dVectorDataPtr d = boost::static_pointer_cast<V3dVectorData>( attr );
-					writeAttr<V3dVectorData, double, 3>( oStream, d.get() );
+					writeType( oStream, 5 );
+					const vector<Imath::V3d> &v = static_cast<const V3dVectorData *>( attr )->readable();
+					writeElements<double>( oStream, (const double *)v.data(), v.size() * 3 );
 				}
 				break;
 			case IntDataTypeId :
-				{
-					int type = 0; type = asBigEndian( type );
-					oStream.write( (const char *)&type, sizeof( type ) );
-					IntDataPtr d = boost::static_pointer_cast<IntData>( attr );
-					writeSimpleAttr<IntData, int, 1>( oStream, d.get() );
-				}
+				writeType( oStream, 0 );
+				writeElements<int>( oStream, &static_cast<const IntData *>( attr )->readable(), 1 );
 				break;
-			// casting FloatData to DoubleData since PDCs don't handle floats
 			case FloatDataTypeId :
-				{
-					castOp.objectParameter()->setValue( attr );
-					castOp.targetTypeParameter()->setNumericValue( DoubleDataTypeId );
-					attr = boost::static_pointer_cast<DoubleData>( castOp.operate() );
-				} // intentionally falling through
+				writeType( oStream, 2 );
+				writeElements<double>( oStream, &static_cast<const FloatData *>( attr )->readable(), 1 );
+				break;
 			case DoubleDataTypeId :
-				{
-					int type = 2; type = asBigEndian( type );
-					oStream.write( (const char *)&type, sizeof( type ) );
-					DoubleDataPtr d = boost::static_pointer_cast<DoubleData>( attr );
-					writeSimpleAttr<DoubleData, double, 1>( oStream, d.get() );
-				}
+				writeType( oStream, 2 );
+				writeElements<double>( oStream, &static_cast<const DoubleData *>( attr )->readable(), 1 );
 				break;
-			// casting V3fData and Color3fData to V3dData since PDCs don't handle floats
 			case V3fDataTypeId :
+				writeType( oStream, 4 );
+				writeElements<double>( oStream, static_cast<const V3fData *>( attr )->readable().getValue(), 3 );
+				break;
 			case Color3fDataTypeId :
-				{
-					castOp.objectParameter()->setValue( attr );
-					castOp.targetTypeParameter()->setNumericValue( V3dDataTypeId );
-					attr = boost::static_pointer_cast<V3dData>( castOp.operate() );
-				} // intentionally falling through
+				writeType( oStream, 4 );
+				writeElements<double>( oStream, static_cast<const Color3fData *>( attr )->readable().getValue(), 3 );
+				break;
 			case V3dDataTypeId :
-				{
-					int type = 4; type = asBigEndian( type );
-					oStream.write( (const char *)&type, sizeof( type ) );
-					V3dDataPtr d = boost::static_pointer_cast<V3dData>( attr );
-					writeSimpleAttr<V3dData, double, 3>( oStream, d.get() );
-				}
+				writeType( oStream, 4 );
+				writeElements<double>( oStream, static_cast<const V3dData *>( attr )->readable().getValue(), 3 );
 				break;
 
 			default :
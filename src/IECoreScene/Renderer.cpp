@@ -34,8 +34,11 @@
 
 #include "IECoreScene/Renderer.h"
 
+#include "IECoreScene/Primitive.h"
+
 #include "IECore/CompoundObject.h"
 #include "IECore/CompoundParameter.h"
+#include "IECore/MessageHandler.h"
 
 using namespace Imath;
 using namespace IECore;
@@ -53,6 +56,43 @@ Renderer::~Renderer()
 {
 }
 
+void Renderer::primitives( const std::vector<ConstPrimitivePtr> &primitives, const std::vector<Imath::M44f> &transforms )
+{
+	if( transforms.empty() )
+	{
+		for( const auto &primitive : primitives )
+		{
+			primitive->render( this );
+		}
+		return;
+	}
+
+	if( transforms.size() != primitives.size() )
+	{
+		msg( Msg::Error, "Renderer::primitives", "Number of transforms does not match number of primitives." );
+		return;
+	}
+
+	for( size_t i = 0, e = primitives.size(); i < e; ++i )
+	{
+		transformBegin();
+		concatTransform( transforms[i] );
+		primitives[i]->render( this );
+		transformEnd();
+	}
+}
+
+void Renderer::instances( const std::string &name, const std::vector<Imath::M44f> &transforms )
+{
+	for( const auto &transform : transforms )
+	{
+		transformBegin();
+		concatTransform( transform );
+		instance( name );
+		transformEnd();
+	}
+}
+
 Renderer::Procedural::Procedural()
 {
 }
@@ -39,9 +39,13 @@
 #include "IECoreScene/PointsPrimitive.h"
 #include "IECoreScene/SceneInterface.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
 #include "tbb/task.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 
 using namespace IECore;
 using namespace IECoreScene;
@@ -109,11 +113,28 @@ class Task : public tbb::task
 
 };
 
+enum Stage
+{
+	BoundsStage,
+	TransformsStage,
+	AttributesStage,
+	TagsStage,
+	SetsStage,
+	ObjectsStage,
+	NumStages
+};
+
+const char *g_stageNames[NumStages] = { "bounds", "transforms", "attributes", "tags", "sets", "objects" };
+
 template<typename T>
 struct CopyInfo
 {
-	CopyInfo() : polygonCount( 0 ), curveCount( 0 ), pointCount( 0 ), attributeCount( 0 ), tagCount( 0 ), setCount( 0 )
+	CopyInfo() : polygonCount( 0 ), curveCount( 0 ), pointCount( 0 ), attributeCount( 0 ), tagCount( 0 ), setCount( 0 ), objectBytes( 0 ), attributeBytes( 0 )
 	{
+		for( auto &t : stageTimes )
+		{
+			t = 0;
+		}
 	}
 
 	T polygonCount;
@@ -123,6 +144,35 @@ struct CopyInfo
 	T attributeCount;
 	T tagCount;
 	T setCount;
+
+	T objectBytes;
+	T attributeBytes;
+
+	// Time spent in each stage, in nanoseconds.
+	T stageTimes[NumStages];
+};
+
+// Accumulates the time between construction and destruction.
+class StageTimer
+{
+
+	public :
+
+		StageTimer( size_t &time )
+			:	m_time( time ), m_start( std::chrono::steady_clock::now() )
+		{
+		}
+
+		~StageTimer()
+		{
+			m_time += std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - m_start ).count();
+		}
+
+	private :
+
+		size_t &m_time;
+		std::chrono::steady_clock::time_point m_start;
+
 };
 
 CopyInfo<size_t> handleLocation( const SceneInterface *src, SceneInterface *dst, double time, unsigned int flags )
@@ -134,6 +184,7 @@ CopyInfo<size_t> handleLocation( const SceneInterface *src, SceneInterface *dst,
 
 	if( flags & SceneAlgo::Bounds )
 	{
+		StageTimer timer( copyInfo.stageTimes[BoundsStage] );
 		auto bound = src->readBound( time );
 		if( dst )
 		{
@@ -143,6 +194,7 @@ CopyInfo<size_t> handleLocation( const SceneInterface *src, SceneInterface *dst,
 
 	if( flags & SceneAlgo::Transforms )
 	{
+		StageTimer timer( copyInfo.stageTimes[TransformsStage] );
 		IECore::ConstDataPtr transform = src->readTransform( time );
 		if( dst && !isRoot )
 		{
@@ -152,6 +204,7 @@ CopyInfo<size_t> handleLocation( const SceneInterface *src, SceneInterface *dst,
 
 	if( flags & SceneAlgo::Attributes )
 	{
+		StageTimer timer( copyInfo.stageTimes[AttributesStage] );
 		SceneInterface::NameList attributeNames;
 		src->attributeNames( attributeNames );
 
@@ -159,6 +212,7 @@ CopyInfo<size_t> handleLocation( const SceneInterface *src, SceneInterface *dst,
 		for( const auto &attributeName : attributeNames )
 		{
 			IECore::ConstObjectPtr attr = src->readAttribute( attributeName, time );
+			copyInfo.attributeBytes += attr->memoryUsage();
 			if( dst )
 			{
 				dst->writeAttribute( attributeName, attr.get(), time );
@@ -168,6 +222,7 @@ CopyInfo<size_t> handleLocation( const SceneInterface *src, SceneInterface *dst,
 
 	if( flags & SceneAlgo::Tags )
 	{
+		StageTimer timer( copyInfo.stageTimes[TagsStage] );
 		SceneInterface::NameList tags;
 		src->readTags( tags );
 		copyInfo.tagCount += tags.size();
@@ -179,6 +234,7 @@ CopyInfo<size_t> handleLocation( const SceneInterface *src, SceneInterface *dst,
 
 	if( flags & SceneAlgo::Sets && isRoot )
 	{
+		StageTimer timer( copyInfo.stageTimes[SetsStage] );
 		SceneInterface::NameList setNames = src->setNames();
 		copyInfo.setCount += setNames.size();
 		for( const auto &setName : setNames )
@@ -193,7 +249,9 @@ CopyInfo<size_t> handleLocation( const SceneInterface *src, SceneInterface *dst,
 
 	if( flags & SceneAlgo::Objects && src->hasObject() )
 	{
+		StageTimer timer( copyInfo.stageTimes[ObjectsStage] );
 		IECore::ConstObjectPtr obj = src->readObject( time );
+		copyInfo.objectBytes += obj->memoryUsage();
 
 		if( IECoreScene::MeshPrimitive::ConstPtr mesh = IECore::runTimeCast<const IECoreScene::MeshPrimitive>( obj ) )
 		{
@@ -240,7 +298,7 @@ namespace IECoreScene
 namespace SceneAlgo
 {
 
-SceneStats parallelReadAll( const SceneInterface *src, int startFrame, int endFrame, float frameRate, unsigned int flags )
+SceneStats parallelReadAll( const SceneInterface *src, int startFrame, int endFrame, float frameRate, unsigned int flags, bool parallelFrames )
 {
 	std::atomic<size_t> locationCount( 0 );
 	::CopyInfo<std::atomic<size_t> > copyInfos;
@@ -252,20 +310,54 @@ SceneStats parallelReadAll( const SceneInterface *src, int startFrame, int endFr
 
 		copyInfos.polygonCount += copyInfo.polygonCount;
 		copyInfos.tagCount += copyInfo.tagCount;
+		copyInfos.setCount += copyInfo.setCount;
 		copyInfos.attributeCount += copyInfo.attributeCount;
 		copyInfos.curveCount += copyInfo.curveCount;
 		copyInfos.pointCount += copyInfo.pointCount;
+		copyInfos.objectBytes += copyInfo.objectBytes;
+		copyInfos.attributeBytes += copyInfo.attributeBytes;
+		for( int i = 0; i < NumStages; ++i )
+		{
+			copyInfos.stageTimes[i] += copyInfo.stageTimes[i];
+		}
 	};
 
-	for( int f = startFrame; f <= endFrame; ++f )
+	auto readFrame = [&]( int f )
 	{
 		double time = f / frameRate;
 		tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
 		Task<decltype( locationFn )> *task = new( tbb::task::allocate_root( taskGroupContext ) ) Task<decltype( locationFn )>( src, nullptr, locationFn, time, flags );
 		tbb::task::spawn_root_and_wait( *task );
+	};
+
+	const auto start = std::chrono::steady_clock::now();
+
+	if( parallelFrames && endFrame > startFrame )
+	{
+		tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+		tbb::parallel_for(
+			tbb::blocked_range<int>( startFrame, endFrame + 1 ),
+			[&readFrame]( const tbb::blocked_range<int> &range ) {
+				for( int f = range.begin(); f != range.end(); ++f )
+				{
+					readFrame( f );
+				}
+			},
+			taskGroupContext
+		);
+	}
+	else
+	{
+		for( int f = startFrame; f <= endFrame; ++f )
+		{
+			readFrame( f );
+		}
 	}
 
+	const auto end = std::chrono::steady_clock::now();
+
 	SceneStats stats;
+	stats["frames"] = std::max( 0, endFrame - startFrame + 1 );
 	stats["locations"] = locationCount;
 	stats["polygons"] = copyInfos.polygonCount;
 	stats["curves"] = copyInfos.curveCount;
@@ -273,6 +365,13 @@ SceneStats parallelReadAll( const SceneInterface *src, int startFrame, int endFr
 	stats["tags"] = copyInfos.tagCount;
 	stats["sets"] = copyInfos.setCount;
 	stats["attributes"] = copyInfos.attributeCount;
+	stats["objectBytes"] = copyInfos.objectBytes;
+	stats["attributeBytes"] = copyInfos.attributeBytes;
+	stats["time"] = std::chrono::duration_cast<std::chrono::nanoseconds>( end - start ).count();
+	for( int i = 0; i < NumStages; ++i )
+	{
+		stats[std::string( g_stageNames[i] ) + "Time"] = copyInfos.stageTimes[i];
+	}
 	return stats;
 }
 
@@ -37,24 +37,37 @@
 
 #include "TagSetAlgo.h"
 
+#include "IECoreScene/CurvesPrimitive.h"
+#include "IECoreScene/MeshPrimitive.h"
 #include "IECoreScene/Primitive.h"
 #include "IECoreScene/SharedSceneInterfaces.h"
 #include "IECoreScene/VisibleRenderable.h"
 
 #include "IECore/ComputationCache.h"
+#include "IECore/DataAlgo.h"
 #include "IECore/FileIndexedIO.h"
 #include "IECore/HeaderGenerator.h"
+#include "IECore/Interpolator.h"
 #include "IECore/MessageHandler.h"
 #include "IECore/ObjectInterpolator.h"
 #include "IECore/SimpleTypedData.h"
 #include "IECore/TransformationMatrixData.h"
+#include "IECore/TypeTraits.h"
 #include "IECore/PathMatcherData.h"
+#include "IECore/VectorTypedData.h"
 
 #include "OpenEXR/ImathBoxAlgo.h"
 
+#include "boost/format.hpp"
 #include "boost/tuple/tuple.hpp"
 
+#include "tbb/atomic.h"
+#include "tbb/blocked_range.h"
 #include "tbb/concurrent_hash_map.h"
+#include "tbb/parallel_for.h"
+
+#include <memory>
+#include <mutex>
 
 using namespace IECore;
 using namespace IECoreScene;
@@ -88,12 +101,143 @@ static InternedString ancestorTagsEntry("ancestorTags");
 static InternedString descendentTagsEntry("descendentTags");
 static InternedString setsEntry("sets");
 static InternedString childSetsEntry("childSets");
+static InternedString columnsEntry("columns");
+static InternedString blocksEntry("blocks");
+static InternedString blockSizeEntry("blockSize");
+static InternedString interpolationsEntry("interpolations");
+static InternedString offsetsEntry("offsets");
 
 const SceneInterface::Name &SceneCache::animatedObjectTopologyAttribute = InternedString( "sceneInterface:animatedObjectTopology" );
 const SceneInterface::Name &SceneCache::animatedObjectPrimVarsAttribute = InternedString( "sceneInterface:animatedObjectPrimVars" );
 
 typedef std::vector<double> SampleTimes;
 
+namespace
+{
+
+tbb::atomic<bool> g_objectDataSharingEnabled;
+tbb::atomic<size_t> g_objectDataMemorySaved;
+
+// Returns data equal to `data`, sharing storage with any identical
+// data previously loaded from any SceneCache.
+template<typename T>
+typename T::ConstPtr shareData( const T *data )
+{
+	ObjectPool *pool = SceneCache::objectDataPool();
+	if( typename T::ConstPtr existing = runTimeCast<const T>( pool->retrieve( data->Object::hash() ) ) )
+	{
+		g_objectDataMemorySaved += data->memoryUsage();
+		return existing;
+	}
+	return runTimeCast<const T>( pool->store( data, ObjectPool::StoreCopy ) );
+}
+
+void sharePrimitiveVariable( PrimitiveVariable &primitiveVariable )
+{
+	primitiveVariable.data = shareData( primitiveVariable.data.get() )->copy();
+	if( primitiveVariable.indices )
+	{
+		primitiveVariable.indices = shareData( primitiveVariable.indices.get() )->copy();
+	}
+}
+
+// Shares the topology of `primitive`, along with its constant primitive
+// variables and any others not listed in `animatedPrimVars`, with equal
+// data already loaded. Since TypedData is copy-on-write, the resulting
+// copies don't use any extra memory for their elements.
+void shareObjectData( Primitive *primitive, const std::vector<InternedString> *animatedPrimVars )
+{
+	if( MeshPrimitive *mesh = runTimeCast<MeshPrimitive>( primitive ) )
+	{
+		mesh->setTopologyUnchecked(
+			shareData( mesh->verticesPerFace() ),
+			shareData( mesh->vertexIds() ),
+			mesh->variableSize( PrimitiveVariable::Vertex ),
+			mesh->interpolation()
+		);
+	}
+	else if( CurvesPrimitive *curves = runTimeCast<CurvesPrimitive>( primitive ) )
+	{
+		curves->setTopology( shareData( curves->verticesPerCurve() ), curves->basis(), curves->periodic() );
+	}
+
+	for( auto &primVar : primitive->variables )
+	{
+		if(
+			primVar.second.interpolation == PrimitiveVariable::Constant ||
+			( animatedPrimVars && std::find( animatedPrimVars->begin(), animatedPrimVars->end(), primVar.first ) == animatedPrimVars->end() )
+		)
+		{
+			sharePrimitiveVariable( primVar.second );
+		}
+	}
+}
+
+// Number of object samples stored in each block of a column,
+// when using SceneCache::ColumnLayout.
+const size_t g_columnBlockSize = 32;
+
+// Appends the elements of `m_source` to the dispatched data,
+// which must be of the same type.
+struct ColumnAppender
+{
+
+	ColumnAppender( const Data *source ) : m_source( source )
+	{
+	}
+
+	template<typename T>
+	void operator()( T *data, typename std::enable_if<TypeTraits::IsVectorTypedData<T>::value>::type *enabler = nullptr )
+	{
+		const typename T::ValueType &source = static_cast<const T *>( m_source )->readable();
+		typename T::ValueType &destination = data->writable();
+		destination.insert( destination.end(), source.begin(), source.end() );
+	}
+
+	void operator()( Data *data )
+	{
+		throw Exception( boost::str( boost::format( "Unexpected column data type \"%s\"" ) % data->typeName() ) );
+	}
+
+	const Data *m_source;
+
+};
+
+// Returns the elements of the dispatched data in the range
+// [m_begin, m_end), with the same type and interpretation.
+struct ColumnSlicer
+{
+
+	ColumnSlicer( size_t begin, size_t end ) : m_begin( begin ), m_end( end )
+	{
+	}
+
+	template<typename T>
+	DataPtr operator()( const T *data, typename std::enable_if<TypeTraits::IsVectorTypedData<T>::value>::type *enabler = nullptr )
+	{
+		const typename T::ValueType &source = data->readable();
+		if( m_end > source.size() || m_begin > m_end )
+		{
+			throw Exception( "Corrupted file! Column offsets out of range." );
+		}
+		typename T::Ptr result = new T;
+		result->writable().assign( source.begin() + m_begin, source.begin() + m_end );
+		setGeometricInterpretation( result.get(), getGeometricInterpretation( data ) );
+		return result;
+	}
+
+	DataPtr operator()( const Data *data )
+	{
+		throw Exception( boost::str( boost::format( "Unexpected column data type \"%s\"" ) % data->typeName() ) );
+	}
+
+	size_t m_begin;
+	size_t m_end;
+
+};
+
+} // namespace
+
 class SceneCache::Implementation : public RefCounted
 {
 	public :
@@ -584,9 +728,16 @@ class SceneCache::ReaderImplementation : public SceneCache::Implementation
 			return m_sharedData->readObjectAtSample( this, sampleIndex );
 		}
 
-		static PrimitiveVariableMap readObjectPrimitiveVariablesAtSample( const IndexedIOPtr &io, const std::vector<InternedString> &primVarNames, size_t sample )
+		PrimitiveVariableMap readObjectPrimitiveVariablesAtSample( const std::vector<InternedString> &primVarNames, size_t sample ) const
+		{
+			PrimitiveVariableMap result = Primitive::loadPrimitiveVariables( m_indexedIO->subdirectory( objectEntry ).get(), sampleEntry(sample), primVarNames );
+			readObjectColumnsAtSample( sample, &primVarNames, result );
+			return result;
+		}
+
+		SceneCache::ObjectLayout objectLayout() const
 		{
-			return Primitive::loadPrimitiveVariables( io->subdirectory( objectEntry ).get(), sampleEntry(sample), primVarNames );
+			return objectColumns().columns.empty() ? SceneCache::SampleLayout : SceneCache::ColumnLayout;
 		}
 
 		PrimitiveVariableMap readObjectPrimitiveVariables( const std::vector<InternedString> &primVarNames, double time ) const
@@ -596,16 +747,15 @@ class SceneCache::ReaderImplementation : public SceneCache::Implementation
 
 			if ( x == 0 )
 			{
-				return readObjectPrimitiveVariablesAtSample(m_indexedIO, primVarNames, sample1);
+				return readObjectPrimitiveVariablesAtSample( primVarNames, sample1 );
 			}
 			if ( x == 1 )
 			{
-				return readObjectPrimitiveVariablesAtSample(m_indexedIO, primVarNames, sample2);
+				return readObjectPrimitiveVariablesAtSample( primVarNames, sample2 );
 			}
 
-			IndexedIOPtr objectIO = m_indexedIO->subdirectory( objectEntry );
-			PrimitiveVariableMap map1 = Primitive::loadPrimitiveVariables( objectIO.get(), sampleEntry(sample1), primVarNames );
-			PrimitiveVariableMap map2 = Primitive::loadPrimitiveVariables( objectIO.get(), sampleEntry(sample2), primVarNames );
+			PrimitiveVariableMap map1 = readObjectPrimitiveVariablesAtSample( primVarNames, sample1 );
+			PrimitiveVariableMap map2 = readObjectPrimitiveVariablesAtSample( primVarNames, sample2 );
 
 			for ( PrimitiveVariableMap::iterator it1 = map1.begin(); it1 != map1.end(); it1++ )
 			{
@@ -619,6 +769,159 @@ class SceneCache::ReaderImplementation : public SceneCache::Implementation
 			return map1;
 		}
 
+		Box3dVectorDataPtr readBoundsAtTimes( const std::vector<double> &times ) const
+		{
+			SampleQueries queries( boundSampleTimes(), times );
+
+			std::vector<Box3d> samples( numBoundSamples() );
+			IndexedIOPtr io = m_indexedIO->subdirectory( boundEntry, IndexedIO::NullIfMissing );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, queries.samples.size() ),
+				[&]( const tbb::blocked_range<size_t> &range ) {
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						const size_t sample = queries.samples[i];
+						if( io )
+						{
+							io->read( sampleEntry( sample ), samples[sample].min.getValue(), 6 );
+						}
+						else
+						{
+							samples[sample] = g_defaults.defaultBox;
+						}
+					}
+				}
+			);
+
+			Box3dVectorDataPtr result = new Box3dVectorData;
+			std::vector<Box3d> &bounds = result->writable();
+			bounds.resize( times.size() );
+			LinearInterpolator<Box3d> interpolator;
+			for( size_t i = 0, e = times.size(); i < e; ++i )
+			{
+				const SampleQuery &q = queries.queries[i];
+				if( q.x == 0 )
+				{
+					bounds[i] = samples[q.floorIndex];
+				}
+				else if( q.x == 1 )
+				{
+					bounds[i] = samples[q.ceilIndex];
+				}
+				else
+				{
+					interpolator( samples[q.floorIndex], samples[q.ceilIndex], q.x, bounds[i] );
+				}
+			}
+
+			return result;
+		}
+
+		M44dVectorDataPtr readTransformsAsMatricesAtTimes( const std::vector<double> &times ) const
+		{
+			SampleQueries queries( transformSampleTimes(), times );
+
+			std::vector<ConstDataPtr> samples( numTransformSamples() );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, queries.samples.size() ),
+				[&]( const tbb::blocked_range<size_t> &range ) {
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						const size_t sample = queries.samples[i];
+						samples[sample] = readTransformAtSample( sample );
+					}
+				}
+			);
+
+			M44dVectorDataPtr result = new M44dVectorData;
+			std::vector<M44d> &matrices = result->writable();
+			matrices.resize( times.size() );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, times.size() ),
+				[&]( const tbb::blocked_range<size_t> &range ) {
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						// Matches SampledSceneInterface::readTransform(), so that
+						// the results are identical to those of readTransformAsMatrix().
+						const SampleQuery &q = queries.queries[i];
+						ConstDataPtr transform;
+						if( q.x == 0 )
+						{
+							transform = samples[q.floorIndex];
+						}
+						else if( q.x == 1 )
+						{
+							transform = samples[q.ceilIndex];
+						}
+						else
+						{
+							transform = runTimeCast<Data>( linearObjectInterpolation( samples[q.floorIndex].get(), samples[q.ceilIndex].get(), q.x ) );
+							if( !transform )
+							{
+								transform = q.x >= 0.5 ? samples[q.ceilIndex] : samples[q.floorIndex];
+							}
+						}
+						matrices[i] = dataToMatrix( transform.get() );
+					}
+				}
+			);
+
+			return result;
+		}
+
+		std::vector<PrimitiveVariableMap> readObjectPrimitiveVariablesAtTimes( const std::vector<InternedString> &primVarNames, const std::vector<double> &times ) const
+		{
+			SampleQueries queries( objectSampleTimes(), times );
+
+			std::vector<PrimitiveVariableMap> samples( numObjectSamples() );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, queries.samples.size() ),
+				[&]( const tbb::blocked_range<size_t> &range ) {
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						const size_t sample = queries.samples[i];
+						samples[sample] = readObjectPrimitiveVariablesAtSample( primVarNames, sample );
+					}
+				}
+			);
+
+			std::vector<PrimitiveVariableMap> result( times.size() );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, times.size() ),
+				[&]( const tbb::blocked_range<size_t> &range ) {
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						const SampleQuery &q = queries.queries[i];
+						if( q.x == 0 )
+						{
+							result[i] = samples[q.floorIndex];
+							continue;
+						}
+						if( q.x == 1 )
+						{
+							result[i] = samples[q.ceilIndex];
+							continue;
+						}
+
+						PrimitiveVariableMap &map = result[i];
+						map = samples[q.floorIndex];
+						const PrimitiveVariableMap &map2 = samples[q.ceilIndex];
+						for( PrimitiveVariableMap::iterator it1 = map.begin(); it1 != map.end(); it1++ )
+						{
+							PrimitiveVariableMap::const_iterator it2 = map2.find( it1->first );
+							if( it2 == map2.end() )
+							{
+								continue;
+							}
+							it1->second.data = boost::static_pointer_cast< Data >( linearObjectInterpolation( it1->second.data.get(), it2->second.data.get(), q.x ) );
+						}
+					}
+				}
+			);
+
+			return result;
+		}
+
 		ReaderImplementationPtr child( const Name &name, MissingBehaviour missingBehaviour )
 		{
 			IndexedIOPtr children = m_indexedIO->subdirectory( childrenEntry, (IndexedIO::MissingBehaviour)missingBehaviour );
@@ -867,7 +1170,8 @@ class SceneCache::ReaderImplementation : public SceneCache::Implementation
 				SharedData() :
 					objectCache( new SimpleCache( doReadObjectAtSample, simpleHash,  10000 )  ),
 					attributeCache( new AttributeCache( doReadAttributeAtSample, attributeHash, 1000) ),
-					transformCache( new SimpleCache(  doReadTransformAtSample, simpleHash, 1000) )
+					transformCache( new SimpleCache(  doReadTransformAtSample, simpleHash, 1000) ),
+					columnBlockCache( new AttributeCache( doReadObjectColumnBlock, columnBlockHash, 100 ) )
 				{
 				}
 
@@ -903,7 +1207,7 @@ class SceneCache::ReaderImplementation : public SceneCache::Implementation
 									if ( prim )
 									{
 										// we managed to load the object from a different time sample from the cache, just have to load the changing prim vars...
-										mergeMaps( prim->variables, readObjectPrimitiveVariablesAtSample( reader->m_indexedIO, varNames->readable(), sample ) );
+										mergeMaps( prim->variables, reader->readObjectPrimitiveVariablesAtSample( varNames->readable(), sample ) );
 										objectCache->set( currentKey, prim.get(), ObjectPool::StoreReference );
 										return prim;
 									}
@@ -927,11 +1231,18 @@ class SceneCache::ReaderImplementation : public SceneCache::Implementation
 					return attributeCache->get( AttributeCacheKey(reader,name,sample) );
 				}
 
+				/// utility function used by the ReaderImplementation to use the LRUCache for reading blocks of ColumnLayout objects
+				IECore::ConstDataPtr readObjectColumnBlock( const ReaderImplementation *reader, const SceneCache::Name &name, size_t block )
+				{
+					return runTimeCast< const Data >( columnBlockCache->get( AttributeCacheKey(reader,name,block) ) );
+				}
+
 				// \todo Consider adding "ReaderImplementation *rootScene" to optimize the scene() calls.
 				SampleTimesMap sampleTimesMap;
 				SimpleCache::Ptr objectCache;
 				AttributeCache::Ptr attributeCache;
 				SimpleCache::Ptr transformCache;
+				AttributeCache::Ptr columnBlockCache;
 
 			private :
 
@@ -963,6 +1274,50 @@ class SceneCache::ReaderImplementation : public SceneCache::Implementation
 
 		};
 
+		struct SampleQuery
+		{
+			size_t floorIndex;
+			size_t ceilIndex;
+			double x;
+		};
+
+		/// Computes the sample interval for each of a list of times,
+		/// along with the unique set of sample indices needed to
+		/// evaluate them all. Used by the batch queries, so that
+		/// each sample is read exactly once regardless of how many
+		/// times reference it.
+		struct SampleQueries
+		{
+			SampleQueries( const SampleTimes &sampleTimes, const std::vector<double> &times )
+			{
+				queries.resize( times.size() );
+				std::vector<bool> required( sampleTimes.size(), false );
+				for( size_t i = 0, e = times.size(); i < e; ++i )
+				{
+					SampleQuery &q = queries[i];
+					q.x = sampleInterval( sampleTimes, times[i], q.floorIndex, q.ceilIndex );
+					if( q.x != 1 )
+					{
+						required[q.floorIndex] = true;
+					}
+					if( q.x != 0 )
+					{
+						required[q.ceilIndex] = true;
+					}
+				}
+				for( size_t i = 0, e = required.size(); i < e; ++i )
+				{
+					if( required[i] )
+					{
+						samples.push_back( i );
+					}
+				}
+			}
+
+			std::vector<SampleQuery> queries;
+			std::vector<size_t> samples;
+		};
+
 		ReaderImplementationPtr m_parent;
 		mutable SharedData *m_sharedData;
 
@@ -973,6 +1328,101 @@ class SceneCache::ReaderImplementation : public SceneCache::Implementation
 		mutable AttributeMapMutex m_attributeMutex;
 		mutable const SampleTimes *m_objectSampleTimes;
 
+		/// Describes how the primitive variables of a ColumnLayout object
+		/// are stored. Per column, `interpolations` holds one value per
+		/// sample, with PrimitiveVariable::Invalid marking samples where the
+		/// variable isn't stored in the column. `offsets` holds the cumulative
+		/// element offset of each sample, with an extra final entry.
+		struct ObjectColumn
+		{
+			std::vector<int> interpolations;
+			std::vector<uint64_t> offsets;
+		};
+
+		struct ObjectColumns
+		{
+			uint64_t blockSize;
+			std::map<SceneCache::Name, ObjectColumn> columns;
+		};
+
+		mutable std::unique_ptr<ObjectColumns> m_objectColumns;
+		mutable std::once_flag m_objectColumnsOnceFlag;
+
+		const ObjectColumns &objectColumns() const
+		{
+			std::call_once(
+				m_objectColumnsOnceFlag,
+				[this] {
+					std::unique_ptr<ObjectColumns> result( new ObjectColumns );
+					result->blockSize = g_columnBlockSize;
+					IndexedIOPtr io = m_indexedIO->subdirectory( objectEntry, IndexedIO::NullIfMissing );
+					if( io )
+					{
+						io = io->subdirectory( columnsEntry, IndexedIO::NullIfMissing );
+					}
+					if( io )
+					{
+						io->read( blockSizeEntry, result->blockSize );
+						if( !result->blockSize )
+						{
+							throw Exception( "Corrupted file! Invalid column block size." );
+						}
+						IndexedIO::EntryIDList names;
+						io->entryIds( names, IndexedIO::Directory );
+						for( const auto &name : names )
+						{
+							ConstIndexedIOPtr columnIO = io->subdirectory( name );
+							ObjectColumn &column = result->columns[name];
+							column.interpolations.resize( columnIO->entry( interpolationsEntry ).arrayLength() );
+							int *interpolations = column.interpolations.data();
+							columnIO->read( interpolationsEntry, interpolations, column.interpolations.size() );
+							// One offset per sample, plus the end of the last sample, so that
+							// readObjectColumnsAtSample() can index them for any valid sample.
+							column.offsets.resize( column.interpolations.size() + 1 );
+							if( columnIO->entry( offsetsEntry ).arrayLength() != column.offsets.size() )
+							{
+								throw Exception( "Corrupted file! Column offsets don't match the number of samples." );
+							}
+							uint64_t *offsets = column.offsets.data();
+							columnIO->read( offsetsEntry, offsets, column.offsets.size() );
+						}
+					}
+					m_objectColumns = std::move( result );
+				}
+			);
+			return *m_objectColumns;
+		}
+
+		// Adds the primitive variables stored in columns to `variables`,
+		// either for all columns or just those named in `primVarNames`.
+		// Variables already in the map take precedence.
+		void readObjectColumnsAtSample( size_t sample, const std::vector<InternedString> *primVarNames, PrimitiveVariableMap &variables ) const
+		{
+			const ObjectColumns &layout = objectColumns();
+			for( const auto &c : layout.columns )
+			{
+				if( primVarNames && std::find( primVarNames->begin(), primVarNames->end(), c.first ) == primVarNames->end() )
+				{
+					continue;
+				}
+				const ObjectColumn &column = c.second;
+				if( sample >= column.interpolations.size() || column.interpolations[sample] == PrimitiveVariable::Invalid )
+				{
+					continue;
+				}
+				if( variables.find( c.first ) != variables.end() )
+				{
+					continue;
+				}
+
+				const size_t block = sample / layout.blockSize;
+				ConstDataPtr blockData = m_sharedData->readObjectColumnBlock( this, c.first, block );
+				const uint64_t blockOffset = column.offsets[block * layout.blockSize];
+				DataPtr data = dispatch( blockData.get(), ColumnSlicer( column.offsets[sample] - blockOffset, column.offsets[sample+1] - blockOffset ) );
+				variables[c.first] = PrimitiveVariable( (PrimitiveVariable::Interpolation)column.interpolations[sample], data );
+			}
+		}
+
 		IndexedIOPtr globalSampleTimes() const
 		{
 			if ( m_parent )
@@ -1101,7 +1551,24 @@ class SceneCache::ReaderImplementation : public SceneCache::Implementation
 		// static function used by the cache mechanism to actually load the object data from file.
 		static ObjectPtr doReadObjectAtSample( const SimpleCacheKey &key )
 		{
-			return Object::load( key.first->m_indexedIO->subdirectory( objectEntry ), sampleEntry(key.second) );
+			ObjectPtr object = Object::load( key.first->m_indexedIO->subdirectory( objectEntry ), sampleEntry(key.second) );
+			if( Primitive *primitive = runTimeCast<Primitive>( object.get() ) )
+			{
+				key.first->readObjectColumnsAtSample( key.second, nullptr, primitive->variables );
+
+				// Primitive variables are only known to be unchanging across samples
+				// if the file records which ones are animated.
+				if( g_objectDataSharingEnabled )
+				{
+					ConstInternedStringVectorDataPtr animatedPrimVars;
+					if( key.first->hasAttribute( animatedObjectPrimVarsAttribute ) )
+					{
+						animatedPrimVars = runTimeCast<const InternedStringVectorData>( key.first->readAttributeAtSample( animatedObjectPrimVarsAttribute, 0 ) );
+					}
+					shareObjectData( primitive, animatedPrimVars ? &animatedPrimVars->readable() : nullptr );
+				}
+			}
+			return object;
 		}
 
 		static MurmurHash attributeHash( const AttributeCacheKey &key )
@@ -1123,6 +1590,20 @@ class SceneCache::ReaderImplementation : public SceneCache::Implementation
 			return Object::load( get<0>(key)->m_indexedIO->subdirectory(attributesEntry)->subdirectory(get<1>(key)), sampleEntry(get<2>(key)) );
 		}
 
+		static MurmurHash columnBlockHash( const AttributeCacheKey &key )
+		{
+			MurmurHash h = attributeHash( key );
+			h.append( columnsEntry.value() );
+			return h;
+		}
+
+		// static function used by the cache mechanism to actually load a block of column data from file.
+		static ObjectPtr doReadObjectColumnBlock( const AttributeCacheKey &key )
+		{
+			IndexedIOPtr io = get<0>(key)->m_indexedIO->subdirectory( objectEntry )->subdirectory( columnsEntry );
+			return Object::load( io->subdirectory( get<1>(key) )->subdirectory( blocksEntry ), sampleEntry( get<2>(key) ) );
+		}
+
 		/// Determine defaults when transform and bounds are not stored in the file.
 		/// The reader will return one sample at time 0 with empty bounding box and
 		/// with identity transform.
@@ -1154,7 +1635,7 @@ class SceneCache::WriterImplementation : public SceneCache::Implementation
 
 		IE_CORE_DECLAREPTR( WriterImplementation )
 
-		WriterImplementation( IndexedIOPtr io, Implementation *parent = nullptr) : SceneCache::Implementation( io ), m_parent(static_cast< WriterImplementation* >( parent ))
+		WriterImplementation( IndexedIOPtr io, Implementation *parent = nullptr) : SceneCache::Implementation( io ), m_parent(static_cast< WriterImplementation* >( parent )), m_objectLayout( SceneCache::SampleLayout )
 		{
 			if ( m_parent )
 			{
@@ -1355,7 +1836,15 @@ class SceneCache::WriterImplementation : public SceneCache::Implementation
 			size_t sampleIndex = m_objectSampleTimes.size();
 			m_objectSampleTimes.push_back( time );
 			IndexedIOPtr io = m_indexedIO->subdirectory( objectEntry, IndexedIO::CreateIfMissing );
-			object->save( io, sampleEntry(sampleIndex) );
+			const Primitive *columnPrimitive = runTimeCast< const Primitive >( object );
+			if ( columnPrimitive && objectLayout() == SceneCache::ColumnLayout )
+			{
+				writeObjectColumns( columnPrimitive, sampleIndex )->save( io, sampleEntry(sampleIndex) );
+			}
+			else
+			{
+				object->save( io, sampleEntry(sampleIndex) );
+			}
 
 			const VisibleRenderable *renderable = runTimeCast< const VisibleRenderable >( object );
 			if ( renderable )
@@ -1426,6 +1915,24 @@ class SceneCache::WriterImplementation : public SceneCache::Implementation
 			}
 		}
 
+		void setObjectLayout( SceneCache::ObjectLayout layout )
+		{
+			writable();
+			if ( m_parent )
+			{
+				m_parent->setObjectLayout( layout );
+			}
+			else
+			{
+				m_objectLayout = layout;
+			}
+		}
+
+		SceneCache::ObjectLayout objectLayout() const
+		{
+			return m_parent ? m_parent->objectLayout() : m_objectLayout;
+		}
+
 		void writeSet(const Name& name, IECore::PathMatcher set )
 		{
 			IECore::PathMatcherDataPtr setData = new IECore::PathMatcherData();
@@ -1738,6 +2245,7 @@ class SceneCache::WriterImplementation : public SceneCache::Implementation
 			{
 				io = m_indexedIO->subdirectory( objectEntry, IndexedIO::CreateIfMissing );
 				storeSampleTimes( m_objectSampleTimes, io );
+				flushObjectColumns();
 			}
 
 			// We have to compute the bounding box over time for the object and each child.
@@ -2112,6 +2620,123 @@ class SceneCache::WriterImplementation : public SceneCache::Implementation
 
 		AnimatedHashTest m_animatedObjectTopology;
 		AnimatedPrimVarMap m_animatedObjectPrimVars;
+
+		// Only used by the root location.
+		SceneCache::ObjectLayout m_objectLayout;
+
+		/// Accumulates the samples of a primitive variable stored using
+		/// SceneCache::ColumnLayout. Blocks are written as soon as they are
+		/// complete, so only the current block is held in memory.
+		struct ObjectColumn
+		{
+			TypeId type;
+			GeometricData::Interpretation interpretation;
+			std::vector<int> interpolations;
+			std::vector<uint64_t> offsets;
+			DataPtr block;
+			size_t blockIndex;
+		};
+		typedef std::map< SceneCache::Name, ObjectColumn > ObjectColumns;
+
+		ObjectColumns m_objectColumns;
+
+		// Moves the unindexed vector primitive variables of `primitive` into
+		// m_objectColumns, returning a copy of the primitive without them.
+		// Variables whose type or interpretation don't match the column are left
+		// in the primitive.
+		ConstPrimitivePtr writeObjectColumns( const Primitive *primitive, size_t sampleIndex )
+		{
+			PrimitivePtr result = primitive->copy();
+			for ( PrimitiveVariableMap::const_iterator it = primitive->variables.begin(); it != primitive->variables.end(); ++it )
+			{
+				const Data *data = it->second.data.get();
+				if ( it->second.indices || !trait<TypeTraits::IsVectorTypedData>( data ) )
+				{
+					continue;
+				}
+
+				std::pair< ObjectColumns::iterator, bool > c = m_objectColumns.insert( ObjectColumns::value_type( it->first, ObjectColumn() ) );
+				ObjectColumn &column = c.first->second;
+				if ( c.second )
+				{
+					column.type = data->typeId();
+					column.interpretation = getGeometricInterpretation( data );
+					column.offsets.push_back( 0 );
+					column.blockIndex = 0;
+				}
+				else if ( data->typeId() != column.type || getGeometricInterpretation( data ) != column.interpretation )
+				{
+					continue;
+				}
+
+				padObjectColumn( column, sampleIndex );
+				const size_t blockIndex = sampleIndex / g_columnBlockSize;
+				if ( blockIndex != column.blockIndex )
+				{
+					writeObjectColumnBlock( column, objectColumnIO( it->first ) );
+					column.blockIndex = blockIndex;
+				}
+
+				if ( !column.block )
+				{
+					column.block = data->copy();
+				}
+				else
+				{
+					dispatch( column.block.get(), ColumnAppender( data ) );
+				}
+				column.interpolations.push_back( it->second.interpolation );
+				column.offsets.push_back( column.offsets.back() + IECore::size( data ) );
+
+				result->variables.erase( it->first );
+			}
+			return result;
+		}
+
+		// Marks the variable as absent from any samples prior to `sampleIndex`
+		// that it hasn't been written for.
+		static void padObjectColumn( ObjectColumn &column, size_t sampleIndex )
+		{
+			const uint64_t offset = column.offsets.back();
+			column.interpolations.resize( sampleIndex, PrimitiveVariable::Invalid );
+			column.offsets.resize( sampleIndex + 1, offset );
+		}
+
+		IndexedIOPtr objectColumnIO( const SceneCache::Name &name )
+		{
+			IndexedIOPtr io = m_indexedIO->subdirectory( objectEntry )->subdirectory( columnsEntry, IndexedIO::CreateIfMissing );
+			return io->subdirectory( name, IndexedIO::CreateIfMissing );
+		}
+
+		static void writeObjectColumnBlock( ObjectColumn &column, IndexedIOPtr columnIO )
+		{
+			if ( column.block )
+			{
+				column.block->save( columnIO->subdirectory( blocksEntry, IndexedIO::CreateIfMissing ), sampleEntry( column.blockIndex ) );
+				column.block = nullptr;
+			}
+		}
+
+		void flushObjectColumns()
+		{
+			if ( m_objectColumns.empty() )
+			{
+				return;
+			}
+
+			IndexedIOPtr columnsIO = m_indexedIO->subdirectory( objectEntry )->subdirectory( columnsEntry, IndexedIO::CreateIfMissing );
+			columnsIO->write( blockSizeEntry, (uint64_t)g_columnBlockSize );
+			for ( ObjectColumns::iterator it = m_objectColumns.begin(); it != m_objectColumns.end(); ++it )
+			{
+				ObjectColumn &column = it->second;
+				IndexedIOPtr columnIO = objectColumnIO( it->first );
+				writeObjectColumnBlock( column, columnIO );
+				padObjectColumn( column, m_objectSampleTimes.size() );
+				columnIO->write( interpolationsEntry, column.interpolations.data(), column.interpolations.size() );
+				columnIO->write( offsetsEntry, column.offsets.data(), column.offsets.size() );
+			}
+			m_objectColumns.clear();
+		}
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -2448,6 +3073,24 @@ PrimitiveVariableMap SceneCache::readObjectPrimitiveVariables( const std::vector
 	return reader->readObjectPrimitiveVariables( primVarNames, time );
 }
 
+Box3dVectorDataPtr SceneCache::readBounds( const std::vector<double> &times ) const
+{
+	ReaderImplementation *reader = ReaderImplementation::reader( m_implementation.get() );
+	return reader->readBoundsAtTimes( times );
+}
+
+M44dVectorDataPtr SceneCache::readTransformsAsMatrices( const std::vector<double> &times ) const
+{
+	ReaderImplementation *reader = ReaderImplementation::reader( m_implementation.get() );
+	return reader->readTransformsAsMatricesAtTimes( times );
+}
+
+std::vector<PrimitiveVariableMap> SceneCache::readObjectPrimitiveVariablesAtTimes( const std::vector<InternedString> &primVarNames, const std::vector<double> &times ) const
+{
+	ReaderImplementation *reader = ReaderImplementation::reader( m_implementation.get() );
+	return reader->readObjectPrimitiveVariablesAtTimes( primVarNames, times );
+}
+
 void SceneCache::writeObject( const Object *object, double time )
 {
 	WriterImplementation *writer = WriterImplementation::writer( m_implementation.get() );
@@ -2556,7 +3199,44 @@ SceneCachePtr SceneCache::duplicate( ImplementationPtr& impl ) const
 	return new SceneCache( impl );
 }
 
+void SceneCache::setObjectDataSharingEnabled( bool enabled )
+{
+	g_objectDataSharingEnabled = enabled;
+}
+
+bool SceneCache::getObjectDataSharingEnabled()
+{
+	return g_objectDataSharingEnabled;
+}
+
+ObjectPool *SceneCache::objectDataPool()
+{
+	static ObjectPoolPtr g_pool = new ObjectPool( 256 * 1024 * 1024 );
+	return g_pool.get();
+}
+
+size_t SceneCache::objectDataMemorySaved()
+{
+	return g_objectDataMemorySaved;
+}
+
 bool SceneCache::readOnly() const
 {
 	return dynamic_cast< const ReaderImplementation* >( m_implementation.get() ) != nullptr;
 }
+
+void SceneCache::setObjectLayout( ObjectLayout layout )
+{
+	WriterImplementation *writer = WriterImplementation::writer( m_implementation.get() );
+	writer->setObjectLayout( layout );
+}
+
+SceneCache::ObjectLayout SceneCache::getObjectLayout() const
+{
+	ReaderImplementation *reader = ReaderImplementation::reader( m_implementation.get(), false );
+	if ( reader )
+	{
+		return reader->objectLayout();
+	}
+	return WriterImplementation::writer( m_implementation.get() )->objectLayout();
+}
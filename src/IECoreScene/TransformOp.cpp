@@ -84,6 +84,11 @@ const StringVectorParameter * TransformOp::primVarsParameter() const
 	return m_primVarsParameter.get();
 }
 
+bool TransformOp::replacesModifiedMembers() const
+{
+	return true;
+}
+
 void TransformOp::modifyPrimitive( Primitive * primitive, const CompoundObject * operands )
 {
 	const std::vector<std::string> &pv = m_primVarsParameter->getTypedValue();
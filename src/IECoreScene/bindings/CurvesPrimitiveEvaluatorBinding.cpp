@@ -41,6 +41,7 @@
 
 #include "IECorePython/RefCountedBinding.h"
 #include "IECorePython/RunTimeTypedBinding.h"
+#include "IECorePython/ScopedGILRelease.h"
 
 #include "OpenEXR/ImathRandom.h"
 
@@ -68,6 +69,35 @@ bool pointAtV( const CurvesPrimitiveEvaluator &e, unsigned curveIndex, float v,
 	return e.pointAtV( curveIndex, v, r );
 }
 
+tuple pointsAtV( const CurvesPrimitiveEvaluator &e, const IntVectorData *curveIndices, const FloatVectorData *v )
+{
+	V3fVectorDataPtr points = new V3fVectorData;
+	V3fVectorDataPtr vTangents = new V3fVectorData;
+	points->setInterpretation( GeometricData::Point );
+	vTangents->setInterpretation( GeometricData::Vector );
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+		e.pointsAtV( curveIndices->readable(), v->readable(), points->writable(), &vTangents->writable() );
+	}
+	return make_tuple( points, vTangents );
+}
+
+object closestPoints( const CurvesPrimitiveEvaluator &e, const V3fVectorData *p )
+{
+	IntVectorDataPtr curveIndices = new IntVectorData;
+	FloatVectorDataPtr v = new FloatVectorData;
+	bool found = false;
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+		found = e.closestPoints( p->readable(), curveIndices->writable(), v->writable() );
+	}
+	if( !found )
+	{
+		return object();
+	}
+	return make_tuple( curveIndices, v );
+}
+
 IntVectorDataPtr verticesPerCurve( const CurvesPrimitiveEvaluator &e )
 {
 	return new IntVectorData( e.verticesPerCurve() );
@@ -226,6 +256,8 @@ void bindCurvesPrimitiveEvaluator()
 				arg( "vEnd" ) = 1.0f
 			)
 		)
+		.def( "pointsAtV", &pointsAtV, ( arg( "curveIndices" ), arg( "v" ) ) )
+		.def( "closestPoints", &closestPoints )
 		.def( "verticesPerCurve", &verticesPerCurve )
 		.def( "vertexDataOffsets", &vertexDataOffsets )
 		.def( "varyingDataOffsets", &varyingDataOffsets )
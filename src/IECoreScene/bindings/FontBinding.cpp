@@ -36,6 +36,8 @@
 // regarding redefinition of _POSIX_C_SOURCE
 #include "boost/python.hpp"
 
+#include "boost/python/suite/indexing/container_utils.hpp"
+
 #include "FontBinding.h"
 
 #include "IECoreScene/Font.h"
@@ -71,6 +73,16 @@ MeshPrimitivePtr mesh2( Font &f, const std::string &s )
 	return f.mesh( s );
 }
 
+MeshPrimitivePtr mesh3( Font &f, object texts, object origins )
+{
+	std::vector<std::string> t;
+	container_utils::extend_container( t, texts );
+	std::vector<Imath::V2f> o;
+	container_utils::extend_container( o, origins );
+	IECorePython::ScopedGILRelease gilRelease;
+	return f.mesh( t, o );
+}
+
 } // namespace
 
 namespace IECoreSceneModule
@@ -87,6 +99,7 @@ void bindFont()
 		.def( "getKerning", &Font::getKerning )
 		.def( "mesh", &mesh1 )
 		.def( "mesh", &mesh2 )
+		.def( "mesh", &mesh3 )
 		.def( "meshGroup", &Font::meshGroup )
 		.def( "advance", &Font::advance )
 		.def( "bound", (Imath::Box2f (Font::*)( )const)&Font::bound )
@@ -39,6 +39,7 @@
 #include "IECoreScene/MeshAlgo.h"
 
 #include "IECorePython/RunTimeTypedBinding.h"
+#include "IECorePython/ScopedGILRelease.h"
 
 using namespace boost::python;
 using namespace IECorePython;
@@ -78,11 +79,77 @@ struct StdPairToTupleConverter
 
 typedef boost::python::list (*Fn)(const MeshPrimitive *mesh, const PrimitiveVariable &primitiveVariable);
 
+// Wrappers which release the GIL while the computation runs,
+// so that meshes may be processed in parallel from Python threads.
+
+std::pair<PrimitiveVariable, PrimitiveVariable> calculateTangents( const MeshPrimitive *mesh, const std::string &uvSet, bool orthoTangents, const std::string &position )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return MeshAlgo::calculateTangents( mesh, uvSet, orthoTangents, position );
+}
+
+PrimitiveVariable calculateFaceArea( const MeshPrimitive *mesh, const std::string &position )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return MeshAlgo::calculateFaceArea( mesh, position );
+}
+
+PrimitiveVariable calculateFaceTextureArea( const MeshPrimitive *mesh, const std::string &uvSet, const std::string &position )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return MeshAlgo::calculateFaceTextureArea( mesh, uvSet, position );
+}
+
+std::pair<PrimitiveVariable, PrimitiveVariable> calculateDistortion( const MeshPrimitive *mesh, const std::string &uvSet, const std::string &referencePosition, const std::string &position )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return MeshAlgo::calculateDistortion( mesh, uvSet, referencePosition, position );
+}
+
+void resamplePrimitiveVariable( const MeshPrimitive *mesh, PrimitiveVariable &primitiveVariable, PrimitiveVariable::Interpolation interpolation )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	MeshAlgo::resamplePrimitiveVariable( mesh, primitiveVariable, interpolation );
+}
+
+MeshPrimitivePtr deleteFaces( const MeshPrimitive *mesh, const PrimitiveVariable &facesToDelete, bool invert )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return MeshAlgo::deleteFaces( mesh, facesToDelete, invert );
+}
+
+void reverseWinding( MeshPrimitive *mesh )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	MeshAlgo::reverseWinding( mesh );
+}
+
+void reorderVertices( MeshPrimitive *mesh, int id0, int id1, int id2 )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	MeshAlgo::reorderVertices( mesh, id0, id1, id2 );
+}
+
+PointsPrimitivePtr distributePoints( const MeshPrimitive *mesh, float density, const Imath::V2f &offset, const std::string &densityMask, const std::string &uvSet, const std::string &position )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return MeshAlgo::distributePoints( mesh, density, offset, densityMask, uvSet, position );
+}
+
+MeshPrimitivePtr triangulate( const MeshPrimitive *mesh, float tolerance, bool throwExceptions )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return MeshAlgo::triangulate( mesh, tolerance, throwExceptions );
+}
 
 boost::python::list segment(const MeshPrimitive *mesh, const PrimitiveVariable &primitiveVariable, const IECore::Data *segmentValues = nullptr)
 {
 	boost::python::list returnList;
-	std::vector<MeshPrimitivePtr> segmented = MeshAlgo::segment(mesh, primitiveVariable, segmentValues);
+	std::vector<MeshPrimitivePtr> segmented;
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+		segmented = MeshAlgo::segment(mesh, primitiveVariable, segmentValues);
+	}
 	for (auto p : segmented)
 	{
 		returnList.append( p );
@@ -106,17 +173,17 @@ void bindMeshAlgo()
 
 	StdPairToTupleConverter<PrimitiveVariable, PrimitiveVariable>();
 
-	def( "calculateTangents", &MeshAlgo::calculateTangents, ( arg_( "mesh" ), arg_( "uvSet" ) = "uv", arg_( "orthoTangents" ) = true, arg_( "position" ) = "P" ) );
-	def( "calculateFaceArea", &MeshAlgo::calculateFaceArea, ( arg_( "mesh" ), arg_( "position" ) = "P" ) );
-	def( "calculateFaceTextureArea", &MeshAlgo::calculateFaceTextureArea, ( arg_( "mesh" ), arg_( "uvSet" ) = "uv", arg_( "position" ) = "P" ) );
-	def( "calculateDistortion", &MeshAlgo::calculateDistortion, ( arg_( "mesh" ), arg_( "uvSet" ) = "uv", arg_( "referencePosition" ) = "Pref", arg_( "position" ) = "P" ) );
-	def( "resamplePrimitiveVariable", &MeshAlgo::resamplePrimitiveVariable );
-	def( "deleteFaces", &MeshAlgo::deleteFaces, arg_( "invert" ) = false );
-	def( "reverseWinding", &MeshAlgo::reverseWinding );
-	def( "reorderVertices", &MeshAlgo::reorderVertices, ( arg_( "mesh" ), arg_( "id0" ), arg_( "id1" ), arg_( "id2" ) ) );
-	def( "distributePoints", &MeshAlgo::distributePoints, ( arg_( "mesh" ), arg_( "density" ) = 100.0, arg_( "offset" ) = Imath::V2f( 0 ), arg_( "densityMask" ) = "density", arg_( "uvSet" ) = "uv", arg_( "position" ) = "P" ) );
+	def( "calculateTangents", &::calculateTangents, ( arg_( "mesh" ), arg_( "uvSet" ) = "uv", arg_( "orthoTangents" ) = true, arg_( "position" ) = "P" ) );
+	def( "calculateFaceArea", &::calculateFaceArea, ( arg_( "mesh" ), arg_( "position" ) = "P" ) );
+	def( "calculateFaceTextureArea", &::calculateFaceTextureArea, ( arg_( "mesh" ), arg_( "uvSet" ) = "uv", arg_( "position" ) = "P" ) );
+	def( "calculateDistortion", &::calculateDistortion, ( arg_( "mesh" ), arg_( "uvSet" ) = "uv", arg_( "referencePosition" ) = "Pref", arg_( "position" ) = "P" ) );
+	def( "resamplePrimitiveVariable", &::resamplePrimitiveVariable );
+	def( "deleteFaces", &::deleteFaces, arg_( "invert" ) = false );
+	def( "reverseWinding", &::reverseWinding );
+	def( "reorderVertices", &::reorderVertices, ( arg_( "mesh" ), arg_( "id0" ), arg_( "id1" ), arg_( "id2" ) ) );
+	def( "distributePoints", &::distributePoints, ( arg_( "mesh" ), arg_( "density" ) = 100.0, arg_( "offset" ) = Imath::V2f( 0 ), arg_( "densityMask" ) = "density", arg_( "uvSet" ) = "uv", arg_( "position" ) = "P" ) );
 	def( "segment", &::segment, segmentOverLoads() );
-	def( "triangulate", &MeshAlgo::triangulate, (arg_("mesh"), arg_("tolerance") =1e-6f, arg_("throwExceptions") = false) );
+	def( "triangulate", &::triangulate, (arg_("mesh"), arg_("tolerance") =1e-6f, arg_("throwExceptions") = false) );
 }
 
 } // namespace IECoreSceneModule
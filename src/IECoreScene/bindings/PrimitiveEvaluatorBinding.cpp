@@ -39,6 +39,12 @@
 #include "IECoreScene/PrimitiveEvaluator.h"
 
 #include "IECorePython/RunTimeTypedBinding.h"
+#include "IECorePython/ScopedGILRelease.h"
+
+#include "IECore/VectorTypedData.h"
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
 
 using namespace IECore;
 using namespace IECorePython;
@@ -57,11 +63,13 @@ struct PrimitiveEvaluatorHelper
 			PyErr_SetString( PyExc_ValueError, "Null primitive" );
 			throw_error_already_set();
 		}
+		IECorePython::ScopedGILRelease gilRelease;
 		return PrimitiveEvaluator::create( primitive );
 	}
 
 	static float signedDistance( PrimitiveEvaluator &evaluator, const Imath::V3f &p, PrimitiveEvaluator::Result *result )
 	{
+		IECorePython::ScopedGILRelease gilRelease;
 
 		float distance = 0.0;
 		bool success = evaluator.signedDistance( p, distance, result );
@@ -77,6 +85,7 @@ struct PrimitiveEvaluatorHelper
 	{
 		evaluator.validateResult( result );
 
+		IECorePython::ScopedGILRelease gilRelease;
 		return evaluator.closestPoint( p, result );
 	}
 
@@ -84,6 +93,7 @@ struct PrimitiveEvaluatorHelper
 	{
 		evaluator.validateResult( result );
 
+		IECorePython::ScopedGILRelease gilRelease;
 		return evaluator.pointAtUV( uv, result );
 	}
 
@@ -91,6 +101,7 @@ struct PrimitiveEvaluatorHelper
 	{
 		evaluator.validateResult( result );
 
+		IECorePython::ScopedGILRelease gilRelease;
 		return evaluator.intersectionPoint( origin, direction, result );
 	}
 
@@ -98,13 +109,17 @@ struct PrimitiveEvaluatorHelper
 	{
 		evaluator.validateResult( result );
 
+		IECorePython::ScopedGILRelease gilRelease;
 		return evaluator.intersectionPoint( origin, direction, result, maxDist );
 	}
 
 	static list intersectionPoints( PrimitiveEvaluator& evaluator, const Imath::V3f &origin, const Imath::V3f &direction )
 	{
 		std::vector< PrimitiveEvaluator::ResultPtr > results;
-		evaluator.intersectionPoints( origin, direction, results );
+		{
+			IECorePython::ScopedGILRelease gilRelease;
+			evaluator.intersectionPoints( origin, direction, results );
+		}
 
 		list result;
 
@@ -119,7 +134,10 @@ struct PrimitiveEvaluatorHelper
 	static list intersectionPoints( PrimitiveEvaluator& evaluator, const Imath::V3f &origin, const Imath::V3f &direction, float maxDistance )
 	{
 		std::vector< PrimitiveEvaluator::ResultPtr > results;
-		evaluator.intersectionPoints( origin, direction, results, maxDistance );
+		{
+			IECorePython::ScopedGILRelease gilRelease;
+			evaluator.intersectionPoints( origin, direction, results, maxDistance );
+		}
 
 		list result;
 
@@ -136,6 +154,80 @@ struct PrimitiveEvaluatorHelper
 		return evaluator.primitive()->copy();
 	}
 
+	// Batch queries. These release the GIL and evaluate the points in
+	// parallel, using a Result per task as required by the threading
+	// guarantees of PrimitiveEvaluator. Points for which the query fails
+	// are left at their default values.
+
+	static FloatVectorDataPtr signedDistances( const PrimitiveEvaluator &evaluator, const V3fVectorData *points )
+	{
+		if( !points )
+		{
+			throw InvalidArgumentException( "Null points" );
+		}
+
+		FloatVectorDataPtr resultData = new FloatVectorData;
+		{
+			IECorePython::ScopedGILRelease gilRelease;
+
+			const std::vector<Imath::V3f> &p = points->readable();
+			std::vector<float> &distances = resultData->writable();
+			distances.resize( p.size(), 0.0f );
+
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, p.size() ),
+				[&evaluator, &p, &distances]( const tbb::blocked_range<size_t> &range ) {
+					PrimitiveEvaluator::ResultPtr result = evaluator.createResult();
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						evaluator.signedDistance( p[i], distances[i], result.get() );
+					}
+				}
+			);
+		}
+
+		return resultData;
+	}
+
+	static tuple closestPointsAndNormals( const PrimitiveEvaluator &evaluator, const V3fVectorData *points )
+	{
+		if( !points )
+		{
+			throw InvalidArgumentException( "Null points" );
+		}
+
+		V3fVectorDataPtr positionsData = new V3fVectorData;
+		V3fVectorDataPtr normalsData = new V3fVectorData;
+		positionsData->setInterpretation( GeometricData::Point );
+		normalsData->setInterpretation( GeometricData::Normal );
+		{
+			IECorePython::ScopedGILRelease gilRelease;
+
+			const std::vector<Imath::V3f> &p = points->readable();
+			std::vector<Imath::V3f> &positions = positionsData->writable();
+			std::vector<Imath::V3f> &normals = normalsData->writable();
+			positions.resize( p.size(), Imath::V3f( 0 ) );
+			normals.resize( p.size(), Imath::V3f( 0 ) );
+
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, p.size() ),
+				[&evaluator, &p, &positions, &normals]( const tbb::blocked_range<size_t> &range ) {
+					PrimitiveEvaluator::ResultPtr result = evaluator.createResult();
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						if( evaluator.closestPoint( p[i], result.get() ) )
+						{
+							positions[i] = result->point();
+							normals[i] = result->normal();
+						}
+					}
+				}
+			);
+		}
+
+		return make_tuple( positionsData, normalsData );
+	}
+
 };
 
 static object primVar( PrimitiveEvaluator::Result &r, PrimitiveVariable &v )
@@ -184,6 +276,8 @@ void bindPrimitiveEvaluator()
 		.def( "intersectionPoint", intersectionPointMaxDist )
 		.def( "intersectionPoints", intersectionPoints )
 		.def( "intersectionPoints", intersectionPointsMaxDist )
+		.def( "signedDistances", &PrimitiveEvaluatorHelper::signedDistances )
+		.def( "closestPointsAndNormals", &PrimitiveEvaluatorHelper::closestPointsAndNormals )
 		.def( "primitive", &PrimitiveEvaluatorHelper::primitive )
 		.def( "volume", &PrimitiveEvaluator::volume )
 		.def( "centerOfGravity", &PrimitiveEvaluator::centerOfGravity )
@@ -38,6 +38,7 @@
 
 #include "RendererBinding.h"
 
+#include "IECoreScene/Primitive.h"
 #include "IECoreScene/Renderer.h"
 
 #include "IECorePython/RunTimeTypedBinding.h"
@@ -314,6 +315,26 @@ static void geometry( Renderer &r, const std::string &type, const dict &topology
 	r.geometry( type, t, p );
 }
 
+static void primitives( Renderer &r, object primitives, object transforms )
+{
+	std::vector<ConstPrimitivePtr> p;
+	container_utils::extend_container( p, primitives );
+	std::vector<Imath::M44f> t;
+	container_utils::extend_container( t, transforms );
+
+	ScopedGILRelease gilRelease;
+	r.primitives( p, t );
+}
+
+static void instances( Renderer &r, const std::string &name, object transforms )
+{
+	std::vector<Imath::M44f> t;
+	container_utils::extend_container( t, transforms );
+
+	ScopedGILRelease gilRelease;
+	r.instances( name, t );
+}
+
 static void instanceBegin( Renderer &r, const std::string &name, const dict &parameters )
 {
 	CompoundDataMap p;
@@ -402,12 +423,14 @@ void bindRenderer()
 		.def("nurbs", &nurbs)
 		.def("patchMesh", &patchMesh)
 		.def("geometry", &geometry)
+		.def("primitives", &primitives, ( arg( "primitives" ), arg( "transforms" ) = list() ) )
 
 		.def("procedural", &procedural)
 
 		.def("instanceBegin", &instanceBegin)
 		.def("instanceEnd", &Renderer::instanceEnd)
 		.def("instance", &Renderer::instance)
+		.def("instances", &instances)
 
 		.def("command", &command)
 
@@ -48,12 +48,12 @@ using namespace IECoreScene;
 namespace
 {
 
-dict parallelReadAll( const SceneInterface *src, int startFrame, int endFrame, float frameRate, unsigned int flags )
+dict parallelReadAll( const SceneInterface *src, int startFrame, int endFrame, float frameRate, unsigned int flags, bool parallelFrames )
 {
 	SceneAlgo::SceneStats stats;
 	{
 		IECorePython::ScopedGILRelease scopedGILRelease;
-		stats = SceneAlgo::parallelReadAll( src, startFrame, endFrame, frameRate, flags );
+		stats = SceneAlgo::parallelReadAll( src, startFrame, endFrame, frameRate, flags, parallelFrames );
 	}
 
 	dict result;
@@ -91,7 +91,10 @@ void bindSceneAlgo()
 
 	def( "copy", &SceneAlgo::copy );
 
-	def( "parallelReadAll", &::parallelReadAll);
+	def(
+		"parallelReadAll", &::parallelReadAll,
+		( arg( "src" ), arg( "startFrame" ), arg( "endFrame" ), arg( "frameRate" ), arg( "flags" ), arg( "parallelFrames" ) = true )
+	);
 }
 
 } // namespace IECoreSceneModule
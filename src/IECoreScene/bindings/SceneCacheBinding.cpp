@@ -42,6 +42,9 @@
 #include "IECoreScene/SharedSceneInterfaces.h"
 
 #include "IECorePython/RunTimeTypedBinding.h"
+#include "IECorePython/ScopedGILRelease.h"
+
+#include "boost/python/suite/indexing/container_utils.hpp"
 
 #include "tbb/tbb.h"
 
@@ -68,6 +71,48 @@ SceneCachePtr constructor2( IECore::IndexedIOPtr indexedIO )
 	return new SceneCache( indexedIO );
 }
 
+Box3dVectorDataPtr readBounds( const SceneCache &s, object times )
+{
+	std::vector<double> t;
+	container_utils::extend_container( t, times );
+	ScopedGILRelease gilRelease;
+	return s.readBounds( t );
+}
+
+M44dVectorDataPtr readTransformsAsMatrices( const SceneCache &s, object times )
+{
+	std::vector<double> t;
+	container_utils::extend_container( t, times );
+	ScopedGILRelease gilRelease;
+	return s.readTransformsAsMatrices( t );
+}
+
+list readObjectPrimitiveVariablesAtTimes( const SceneCache &s, object primVarNames, object times )
+{
+	SceneInterface::NameList n;
+	container_utils::extend_container( n, primVarNames );
+	std::vector<double> t;
+	container_utils::extend_container( t, times );
+
+	std::vector<PrimitiveVariableMap> maps;
+	{
+		ScopedGILRelease gilRelease;
+		maps = s.readObjectPrimitiveVariablesAtTimes( n, t );
+	}
+
+	list result;
+	for( const auto &m : maps )
+	{
+		dict d;
+		for( const auto &p : m )
+		{
+			d[p.first] = p.second;
+		}
+		result.append( d );
+	}
+	return result;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -166,9 +211,29 @@ namespace IECoreSceneModule
 
 void bindSceneCache()
 {
-	RunTimeTypedClass<SceneCache>()
+	RunTimeTypedClass<SceneCache> sceneCacheClass;
+
+	{
+		scope s( sceneCacheClass );
+
+		enum_<SceneCache::ObjectLayout>( "ObjectLayout" )
+			.value( "SampleLayout", SceneCache::SampleLayout )
+			.value( "ColumnLayout", SceneCache::ColumnLayout )
+		;
+	}
+
+	sceneCacheClass
 		.def( "__init__", make_constructor( &constructor ), "Opens a scene file for read or write." )
 		.def( "__init__", make_constructor( &constructor2 ), "Opens a scene from a previously opened file handle." )
+		.def( "readBounds", &readBounds )
+		.def( "readTransformsAsMatrices", &readTransformsAsMatrices )
+		.def( "readObjectPrimitiveVariablesAtTimes", &readObjectPrimitiveVariablesAtTimes )
+		.def( "setObjectLayout", &SceneCache::setObjectLayout )
+		.def( "getObjectLayout", &SceneCache::getObjectLayout )
+		.def( "setObjectDataSharingEnabled", &SceneCache::setObjectDataSharingEnabled ).staticmethod( "setObjectDataSharingEnabled" )
+		.def( "getObjectDataSharingEnabled", &SceneCache::getObjectDataSharingEnabled ).staticmethod( "getObjectDataSharingEnabled" )
+		.def( "objectDataPool", &SceneCache::objectDataPool, return_value_policy<CastToIntrusivePtr>() ).staticmethod( "objectDataPool" )
+		.def( "objectDataMemorySaved", &SceneCache::objectDataMemorySaved ).staticmethod( "objectDataMemorySaved" )
 	;
 
 	def( "testSceneCacheParallelAttributeRead", &testSceneCacheParallelAttributeRead );
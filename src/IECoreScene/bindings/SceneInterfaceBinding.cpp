@@ -36,14 +36,19 @@
 
 #include "SceneInterfaceBinding.h"
 
+#include "IECoreScene/SceneCache.h"
 #include "IECoreScene/SceneInterface.h"
 #include "IECoreScene/SharedSceneInterfaces.h"
 
 #include "IECorePython/IECoreBinding.h"
 #include "IECorePython/RunTimeTypedBinding.h"
+#include "IECorePython/ScopedGILRelease.h"
 
 #include "boost/python/suite/indexing/container_utils.hpp"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
 using namespace boost::python;
 using namespace IECore;
 using namespace IECorePython;
@@ -132,7 +137,11 @@ static dict readObjectPrimitiveVariables( const SceneInterface &m, list varNameL
 	SceneInterface::NameList v;
 	container_utils::extend_container( v, varNameList );
 
-	PrimitiveVariableMap varMap = m.readObjectPrimitiveVariables( v, time );
+	PrimitiveVariableMap varMap;
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+		varMap = m.readObjectPrimitiveVariables( v, time );
+	}
 	dict result;
 	for( PrimitiveVariableMap::const_iterator it = varMap.begin(); it != varMap.end(); it++ )
 	{
@@ -160,8 +169,15 @@ void writeTags( SceneInterface &m, list tagList )
 	m.writeTags( v );
 }
 
+Imath::Box3d readBound( const SceneInterface &m, double time )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return m.readBound( time );
+}
+
 DataPtr readTransform( SceneInterface &m, double time )
 {
+	IECorePython::ScopedGILRelease gilRelease;
 	ConstDataPtr t = m.readTransform( time );
 	if( t )
 	{
@@ -170,8 +186,15 @@ DataPtr readTransform( SceneInterface &m, double time )
 	return nullptr;
 }
 
+Imath::M44d readTransformAsMatrix( const SceneInterface &m, double time )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return m.readTransformAsMatrix( time );
+}
+
 ObjectPtr readAttribute( SceneInterface &m, const SceneInterface::Name &name, double time )
 {
+	IECorePython::ScopedGILRelease gilRelease;
 	ConstObjectPtr o = m.readAttribute( name, time );
 	if( o )
 	{
@@ -182,6 +205,7 @@ ObjectPtr readAttribute( SceneInterface &m, const SceneInterface::Name &name, do
 
 ObjectPtr readObject( SceneInterface &m, double time )
 {
+	IECorePython::ScopedGILRelease gilRelease;
 	ConstObjectPtr o = m.readObject( time );
 	if( o )
 	{
@@ -190,8 +214,76 @@ ObjectPtr readObject( SceneInterface &m, double time )
 	return nullptr;
 }
 
+void writeObject( SceneInterface &m, const Object *object, double time )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	m.writeObject( object, time );
+}
+
+ObjectPtr readObjectAtPath( const SceneInterface &m, const SceneInterface::Path &path, double time )
+{
+	ConstSceneInterfacePtr s = m.scene( path );
+	if( !s->hasObject() )
+	{
+		return nullptr;
+	}
+	ConstObjectPtr o = s->readObject( time );
+	return o ? o->copy() : nullptr;
+}
+
+// Reads the objects at a list of paths relative to `m`. Returns None for
+// locations without an object. Reads are performed in parallel only for
+// implementations known to support concurrent reads, because an arbitrary
+// SceneInterface may not be thread-safe.
+list readObjects( const SceneInterface &m, list pathList, double time )
+{
+	std::vector<SceneInterface::Path> paths;
+	const size_t numPaths = len( pathList );
+	paths.reserve( numPaths );
+	for( size_t i = 0; i < numPaths; ++i )
+	{
+		SceneInterface::Path p;
+		container_utils::extend_container( p, pathList[i] );
+		paths.push_back( p );
+	}
+
+	std::vector<ObjectPtr> objects( numPaths );
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+		if( m.typeId() == SceneCache::staticTypeId() )
+		{
+			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, numPaths ),
+				[&m, &paths, &objects, time]( const tbb::blocked_range<size_t> &range ) {
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						objects[i] = readObjectAtPath( m, paths[i], time );
+					}
+				},
+				taskGroupContext
+			);
+		}
+		else
+		{
+			for( size_t i = 0; i < numPaths; ++i )
+			{
+				objects[i] = readObjectAtPath( m, paths[i], time );
+			}
+		}
+	}
+
+	list result;
+	for( const auto &o : objects )
+	{
+		result.append( o );
+	}
+	return result;
+}
+
 static MurmurHash sceneHash( SceneInterface &m, SceneInterface::HashType hashType, double time )
 {
+	IECorePython::ScopedGILRelease gilRelease;
 	MurmurHash h;
 	m.hash( hashType, time, h );
 	return h;
@@ -257,10 +349,10 @@ void bindSceneInterface()
 		.def( "pathAsString", pathAsString )
 		.def( "name", &SceneInterface::name )
 		.def( "hasBound", &SceneInterface::hasBound )
-		.def( "readBound", &SceneInterface::readBound )
+		.def( "readBound", &readBound )
 		.def( "writeBound", &SceneInterface::writeBound )
 		.def( "readTransform", &readTransform )
-		.def( "readTransformAsMatrix", &SceneInterface::readTransformAsMatrix )
+		.def( "readTransformAsMatrix", &readTransformAsMatrix )
 		.def( "writeTransform", &SceneInterface::writeTransform )
 		.def( "hasAttribute", &SceneInterface::hasAttribute )
 		.def( "attributeNames", attributeNames )
@@ -274,8 +366,9 @@ void bindSceneInterface()
 		.def( "hashSet", &hashSet )
 		.def( "readSet", &SceneInterface::readSet, ( arg_("name"), arg_( "includeDescendantSets" ) = true ) )
 		.def( "readObject", &readObject )
+		.def( "readObjects", &readObjects, ( arg( "paths" ), arg( "time" ) ) )
 		.def( "readObjectPrimitiveVariables", &readObjectPrimitiveVariables )
-		.def( "writeObject", &SceneInterface::writeObject )
+		.def( "writeObject", &writeObject )
 		.def( "hasObject", &SceneInterface::hasObject )
 		.def( "hasChild", &SceneInterface::hasChild )
 		.def( "childNames", &childNames )
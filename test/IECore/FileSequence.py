@@ -458,6 +458,48 @@ class testLs( unittest.TestCase ) :
 		l = IECore.ls( "test/sequences/lsTest/a.###.tif" )
 		self.assertFalse( l )
 
+	def testNameParsing( self ) :
+
+		l = IECore.findSequences( [
+			"a.0001.mp3", "a.0002.mp3",
+			"b.mp3", "b.mp4",
+			"c-1.tif", "c-2.tif",
+			"d#1.tif", "d#2.tif",
+			"e.99999999999999999999.tif", "e.99999999999999999998.tif",
+		] )
+
+		self.assertEqual(
+			l,
+			[
+				IECore.FileSequence( "a.####.mp3", IECore.FrameRange( 1, 2 ) ),
+				IECore.FileSequence( "b.mp#", IECore.FrameRange( 3, 4 ) ),
+				IECore.FileSequence( "c#.tif", IECore.FrameRange( -2, -1 ) ),
+			]
+		)
+
+	def testMultipleDirectories( self ) :
+
+		self.tearDown()
+
+		sequences = [
+			IECore.FileSequence( "test/sequences/lsTest/a/a.####.tif", IECore.FrameRange( 1, 100 ) ),
+			IECore.FileSequence( "test/sequences/lsTest/b/b.#.exr", IECore.FrameRange( 5, 10 ) ),
+		]
+
+		for sequence in sequences :
+			os.makedirs( os.path.dirname( sequence.fileName ) )
+			for f in sequence.fileNames() :
+				open( f, "w" ).close()
+
+		l = IECore.ls( [ os.path.dirname( s.fileName ) for s in sequences ] + [ "test/sequences/lsTest" ] )
+		self.assertEqual( len( l ), 3 )
+
+		for sequence, ll in zip( sequences, l ) :
+			self.assertEqual( ll, [ IECore.FileSequence( os.path.basename( sequence.fileName ), sequence.frameList ) ] )
+			self.assertEqual( ll, IECore.ls( os.path.dirname( sequence.fileName ) ) )
+
+		self.assertEqual( l[2], [] )
+
 	def tearDown( self ) :
 
 		if os.path.exists( "test/sequences" ) :
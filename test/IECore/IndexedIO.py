@@ -417,6 +417,26 @@ class TestFileIndexedIO(unittest.TestCase):
 		for n in range(0, 1000):
 			self.assertEqual(fv[n], gv[n])
 
+	def testReadMultipleEntries(self):
+		"""Test FileIndexedIO read( names )"""
+
+		f = IECore.FileIndexedIO("./test/FileIndexedIO.fio", [], IECore.IndexedIO.OpenMode.Write)
+		f = f.subdirectory("sub1", IECore.IndexedIO.MissingBehaviour.CreateIfMissing )
+
+		names = [ "entry%d" % i for i in range( 0, 100 ) ]
+		for i, name in enumerate( names ) :
+			f.write( name, IECore.IntVectorData( range( 0, i + 1 ) ) )
+		f.write( "string", "test" )
+
+		expected = [ IECore.IntVectorData( range( 0, i + 1 ) ) for i in range( 0, 100 ) ] + [ IECore.StringData( "test" ) ]
+		self.assertEqual( f.read( names + [ "string" ] ), expected )
+
+		del f
+
+		f = IECore.FileIndexedIO("./test/FileIndexedIO.fio", [ "sub1" ], IECore.IndexedIO.OpenMode.Read)
+		self.assertEqual( f.read( names + [ "string" ] ), expected )
+		self.assertEqual( f.read( [] ), [] )
+
 	def testReadWriteDoubleVector(self):
 		"""Test FileIndexedIO read/write(DoubleVector)"""
 
@@ -172,6 +172,29 @@ class TestObject( unittest.TestCase ) :
 		bb.copyFrom( b )
 		self.assertEqual( b, bb )
 
+	def testShallowCopy( self ) :
+
+		c = IECore.CompoundObject( {
+			"a" : IECore.IntVectorData( [ 1, 2, 3 ] ),
+			"b" : IECore.CompoundObject( { "c" : IECore.StringData( "c" ) } ),
+		} )
+
+		cc = c.shallowCopy()
+		self.assertEqual( cc, c )
+		self.assertFalse( cc.isSame( c ) )
+		self.assertTrue( cc["a"].isSame( c["a"] ) )
+		self.assertTrue( cc["b"].isSame( c["b"] ) )
+
+		# Replacing a member doesn't affect the original.
+		cc["a"] = IECore.IntVectorData( [ 4, 5, 6 ] )
+		self.assertEqual( c["a"], IECore.IntVectorData( [ 1, 2, 3 ] ) )
+
+		d = IECore.IntVectorData( [ 1, 2, 3 ] )
+		dd = d.shallowCopy()
+		self.assertEqual( dd, d )
+		dd[0] = 10
+		self.assertEqual( d[0], 1 )
+
 	def testHash( self ) :
 
 		allHashes = set()
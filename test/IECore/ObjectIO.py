@@ -33,6 +33,7 @@
 ##########################################################################
 
 import os
+import time
 import unittest
 import random
 import imath
@@ -262,9 +263,65 @@ class TestObjectIO( unittest.TestCase ) :
 		self.assert_( dd['c']['d'].isSame( dd['links']['v3'] ) )
 		self.assert_( dd['c/d'].isSame( dd['links']['v3'] ) )
 
+	def testManyMembers( self ) :
+
+		# Large enough to exercise the parallel code paths used for
+		# hashing, compression and loading of siblings.
+
+		shared = IECore.V3fVectorData( [ imath.V3f( i ) for i in range( 0, 300000 ) ] )
+
+		o = IECore.CompoundObject()
+		for i in range( 0, 20 ) :
+			d = IECore.CompoundData()
+			d["floats"] = IECore.FloatVectorData( [ float( i + j ) for j in range( 0, 300000 ) ] )
+			d["shared"] = shared
+			o["member%d" % i] = d
+			o["sharedMember%d" % i] = shared
+
+		for fileName in [ "test/o.fio", "test/o2.fio" ] :
+			f = IECore.FileIndexedIO( fileName, [], IECore.IndexedIO.OpenMode.Write )
+			o.save( f, "test" )
+			del f
+
+		# Saving must be deterministic.
+		with open( "test/o.fio", "rb" ) as f1, open( "test/o2.fio", "rb" ) as f2 :
+			self.assertEqual( f1.read(), f2.read() )
+
+		f = IECore.FileIndexedIO( "test/o.fio", [], IECore.IndexedIO.OpenMode.Read )
+		for n in range( 0, 5 ) :
+			oo = IECore.Object.load( f, "test" )
+			self.assertEqual( o, oo )
+			for i in range( 0, 20 ) :
+				self.assertTrue( oo["member%d" % i]["shared"].isSame( oo["sharedMember0"] ) )
+				self.assertTrue( oo["sharedMember%d" % i].isSame( oo["sharedMember0"] ) )
+
+	@unittest.skipUnless( os.environ.get("CORTEX_PERFORMANCE_TEST", False), "'CORTEX_PERFORMANCE_TEST' env var not set" )
+	def testManySmallObjectsPerformance( self ) :
+
+		o = IECore.CompoundObject()
+		for i in range( 0, 1000 ) :
+			d = IECore.CompoundObject()
+			for j in range( 0, 200 ) :
+				d["int%d" % j] = IECore.IntData( j )
+				d["string%d" % j] = IECore.StringData( "string%d" % j )
+			o["member%d" % i] = d
+
+		t = time.time()
+		f = IECore.FileIndexedIO( "test/o.fio", [], IECore.IndexedIO.OpenMode.Write )
+		o.save( f, "test" )
+		del f
+		print( "save : {0:.3f}s".format( time.time() - t ) )
+
+		f = IECore.FileIndexedIO( "test/o.fio", [], IECore.IndexedIO.OpenMode.Read )
+		t = time.time()
+		oo = IECore.Object.load( f, "test" )
+		print( "load : {0:.3f}s".format( time.time() - t ) )
+
+		self.assertEqual( o, oo )
+
 	def tearDown( self ) :
 
-		for f in [ "test/o.fio", "test/FileIndexedIOSlashes.fio" ] :
+		for f in [ "test/o.fio", "test/o2.fio", "test/FileIndexedIOSlashes.fio" ] :
 			if os.path.isfile( f ) :
 				os.remove( f )
 
@@ -32,7 +32,9 @@
 #
 ##########################################################################
 
+import os
 import sys
+import time
 import unittest
 
 import IECore
@@ -179,6 +181,26 @@ class TestRunTimeTyped( unittest.TestCase ) :
 		self.failIf( IECore.RunTimeTyped.inheritsFrom( IECore.TypeId.CompoundObject, IECore.TypeId.Writer ) )
 		self.failIf( IECore.RunTimeTyped.inheritsFrom( "CompoundObject", "Writer" ) )
 
+	def __inheritsFromTestTypes( self ) :
+
+		return [
+			IECore.TypeId.RunTimeTyped, IECore.TypeId.Object, IECore.TypeId.Data,
+			IECore.TypeId.IntData, IECore.TypeId.CompoundObject, IECore.TypeId.Writer,
+		]
+
+	def testInheritsFromConcurrency( self ) :
+
+		typeIds = self.__inheritsFromTestTypes()
+		expected = sum( IECore.RunTimeTyped.inheritsFrom( t, b ) for t in typeIds for b in typeIds )
+		self.assertEqual( IECore.testRunTimeTypedInheritsFromConcurrency( typeIds, 1000 ), expected * 1000 )
+
+	@unittest.skipUnless( os.environ.get("CORTEX_PERFORMANCE_TEST", False), "'CORTEX_PERFORMANCE_TEST' env var not set" )
+	def testInheritsFromConcurrencyPerformance( self ) :
+
+		t = time.time()
+		IECore.testRunTimeTypedInheritsFromConcurrency( self.__inheritsFromTestTypes(), 1000000 )
+		print( "inheritsFrom : {0:.3f}s".format( time.time() - t ) )
+
 	def testRegisterPrefixedTypeName( self ) :
 
 		class Prefixed( IECore.Op ) :
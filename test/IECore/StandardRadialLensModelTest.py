@@ -86,6 +86,32 @@ class StandardRadialLensModelTest(unittest.TestCase):
 		bbox = lens.bounds( IECore.LensModel.Distort, window, 2048, 1556 )
 		self.assertEqual( bbox, imath.Box2i( imath.V2i( 351, 640 ), imath.V2i( 1696, 1298 ) ) )
 
+	def testBatchDistortion( self ):
+
+		lens = IECore.LensModel.create( "StandardRadialLensModel" )
+		lens["distortion"] = 0.2
+		lens["curvatureX"] = 0.2
+		lens["curvatureY"] = 0.5
+		lens["quarticDistortion"] = .1
+		lens["lensCenterOffsetXCm"] = .25
+		lens.validate()
+
+		points = IECore.V2dVectorData(
+			[ imath.V2d( x / 20.0, y / 20.0 ) for x in range( 0, 21 ) for y in range( 0, 21 ) ]
+		)
+
+		distorted = lens.distortPoints( points )
+		undistorted = lens.undistortPoints( points )
+		self.assertEqual( len( distorted ), len( points ) )
+		self.assertEqual( len( undistorted ), len( points ) )
+
+		for i, p in enumerate( points ) :
+			self.assertEqual( distorted[i], lens.distort( p ) )
+			self.assertEqual( undistorted[i], lens.undistort( p ) )
+			self.assertTrue( lens.undistort( distorted[i] ).equalWithAbsError( p, 1e-6 ) )
+
+		self.assertEqual( len( lens.distortPoints( IECore.V2dVectorData() ) ), 0 )
+
 	def testStandardRadialLensModelCreatorFromName( self ):
 
 		lens = IECore.LensModel.create( "StandardRadialLensModel" )
@@ -1282,6 +1282,74 @@ class TestInternedStringVectorData( unittest.TestCase ) :
 
 		self.assertEqual( d2, d )
 
+class TestVectorDataAllocation( unittest.TestCase ) :
+
+	def setUp( self ) :
+
+		self.__threshold = IECore.VectorDataAllocation.getHugePageThreshold()
+
+	def tearDown( self ) :
+
+		IECore.VectorDataAllocation.setHugePageThreshold( self.__threshold )
+
+	def testThreshold( self ) :
+
+		IECore.VectorDataAllocation.setHugePageThreshold( 4 * 1024 * 1024 )
+		self.assertEqual( IECore.VectorDataAllocation.getHugePageThreshold(), 4 * 1024 * 1024 )
+
+		IECore.VectorDataAllocation.setHugePageThreshold( 0 )
+		self.assertEqual( IECore.VectorDataAllocation.getHugePageThreshold(), 0 )
+
+	def testCopyAndLoad( self ) :
+
+		IECore.VectorDataAllocation.setHugePageThreshold( 1024 * 1024 )
+		advisedBytes = IECore.VectorDataAllocation.hugePageAdvisedBytes()
+
+		d = IECore.V3fVectorData( [ imath.V3f( i ) for i in range( 0, 200000 ) ] )
+
+		# Writing to a copy duplicates the shared storage.
+		d2 = d.copy()
+		d2[0] = imath.V3f( -1 )
+		self.assertEqual( d2[0], imath.V3f( -1 ) )
+		self.assertEqual( d[0], imath.V3f( 0 ) )
+		self.assertEqual( d2[1:], d[1:] )
+
+		m = IECore.MemoryIndexedIO( IECore.CharVectorData(), [], IECore.IndexedIO.OpenMode.Append )
+		d.save( m, "o" )
+		d3 = IECore.Object.load( m, "o" )
+		self.assertEqual( d3, d )
+		self.assertEqual( d3.memoryUsage(), d.memoryUsage() )
+
+		# The advice is only applied where the OS supports it, so
+		# we can only assert that the count never goes backwards.
+		self.assertGreaterEqual( IECore.VectorDataAllocation.hugePageAdvisedBytes(), advisedBytes )
+
+	@unittest.skipUnless( os.environ.get("CORTEX_PERFORMANCE_TEST", False), "'CORTEX_PERFORMANCE_TEST' env var not set" )
+	def testPerformance( self ) :
+
+		d = IECore.FloatVectorData( 256 * 1024 * 1024 )
+		m = IECore.MemoryIndexedIO( IECore.CharVectorData(), [], IECore.IndexedIO.OpenMode.Append )
+		d.save( m, "o" )
+
+		for threshold in ( 0, 2 * 1024 * 1024 ) :
+
+			IECore.VectorDataAllocation.setHugePageThreshold( threshold )
+
+			t = IECore.Timer()
+			d2 = d.copy()
+			d2[0] = 1
+			copyTime = t.stop()
+
+			t = IECore.Timer()
+			d3 = IECore.Object.load( m, "o" )
+			loadTime = t.stop()
+
+			t = IECore.Timer()
+			d2.hash()
+			hashTime = t.stop()
+
+			print( "Huge page threshold {0} : copy {1:.3f}s, load {2:.3f}s, hash {3:.3f}s".format( threshold, copyTime, loadTime, hashTime ) )
+
 if __name__ == "__main__":
     unittest.main()
 
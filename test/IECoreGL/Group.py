@@ -32,6 +32,7 @@
 #
 ##########################################################################
 
+import os
 import unittest
 import imath
 
@@ -69,6 +70,69 @@ class TestGroup( unittest.TestCase ) :
 		g.clearChildren()
 		self.assertEqual( g.children(), [] )
 
+	def testBoundUpdatesWhenDescendantsChange( self ) :
+
+		g = IECoreGL.Group()
+		g2 = IECoreGL.Group()
+		g.addChild( g2 )
+		self.assertTrue( g.bound().isEmpty() )
+
+		mesh = IECoreScene.MeshPrimitive.createBox( imath.Box3f( imath.V3f( -1 ), imath.V3f( 1 ) ) )
+		g2.addChild( IECoreGL.ToGLMeshConverter( mesh ).convert() )
+		self.assertEqual( g.bound(), imath.Box3f( imath.V3f( -1 ), imath.V3f( 1 ) ) )
+
+		g2.setTransform( imath.M44f().translate( imath.V3f( 10, 0, 0 ) ) )
+		self.assertEqual( g.bound(), imath.Box3f( imath.V3f( 9, -1, -1 ), imath.V3f( 11, 1, 1 ) ) )
+
+		g2.clearChildren()
+		self.assertTrue( g.bound().isEmpty() )
+
+	def testBoundUpdatesWhenInstancerChanges( self ) :
+
+		mesh = IECoreScene.MeshPrimitive.createBox( imath.Box3f( imath.V3f( -1 ), imath.V3f( 1 ) ) )
+		instancer = IECoreGL.PrimitiveInstancer( IECoreGL.ToGLMeshConverter( mesh ).convert() )
+		instancer.addInstance( imath.M44f() )
+
+		g = IECoreGL.Group()
+		g.addChild( instancer )
+		self.assertEqual( g.bound(), imath.Box3f( imath.V3f( -1 ), imath.V3f( 1 ) ) )
+
+		instancer.addInstance( imath.M44f().translate( imath.V3f( 10, 0, 0 ) ) )
+		self.assertEqual( g.bound(), imath.Box3f( imath.V3f( -1 ), imath.V3f( 11, 1, 1 ) ) )
+
+	def testFrustumCulling( self ) :
+
+		r = IECoreGL.Renderer()
+		r.setOption( "gl:mode", IECore.StringData( "deferred" ) )
+		r.setOption( "gl:searchPath:shader", IECore.StringData( os.path.dirname( __file__ ) + "/shaders" ) )
+
+		with IECoreScene.WorldBlock( r ) :
+
+			r.setAttribute( "gl:frustumCulling", IECore.BoolData( True ) )
+			r.concatTransform( imath.M44f().translate( imath.V3f( 0, 0, -5 ) ) )
+
+			r.setAttribute( "name", IECore.StringData( "onScreen" ) )
+			r.sphere( 1, -1, 1, 360, {} )
+
+			with IECoreScene.AttributeBlock( r ) :
+				r.concatTransform( imath.M44f().translate( imath.V3f( 100, 0, 0 ) ) )
+				r.setAttribute( "name", IECore.StringData( "offScreen" ) )
+				r.sphere( 1, -1, 1, 360, {} )
+				r.sphere( 1, -1, 1, 360, {} )
+
+		s = r.scene()
+		s.setCamera( IECoreGL.Camera( imath.M44f(), False ) )
+
+		IECoreGL.Group.resetStatistics()
+		hits = s.select( IECoreGL.Selector.Mode.GLSelect, imath.Box2f( imath.V2f( 0 ), imath.V2f( 1 ) ) )
+		names = [ IECoreGL.NameStateComponent.nameFromGLName( x.name ) for x in hits ]
+		self.assertEqual( names, [ "onScreen" ] )
+
+		statistics = IECoreGL.Group.statistics()
+		self.assertEqual( statistics.renderedPrimitives, 1 )
+		self.assertEqual( statistics.culledPrimitives, 2 )
+		self.assertGreaterEqual( statistics.culledGroups, 1 )
+
 
 if __name__ == "__main__":
     unittest.main()
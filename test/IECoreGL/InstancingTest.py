@@ -32,6 +32,8 @@
 #
 ##########################################################################
 
+import os
+import time
 import unittest
 import imath
 
@@ -140,5 +142,139 @@ class InstancingTest( unittest.TestCase ) :
 			for i in range( 1, len( meshList ) ) :
 				self.failIf( meshList[i].isSame( meshList[0] ) )
 
+	def __renderRepeatedMeshes( self, numMeshes, automaticInstancing = True ) :
+
+		m = IECoreScene.MeshPrimitive.createBox( imath.Box3f( imath.V3f( -0.5 ), imath.V3f( 0.5 ) ) )
+
+		r = IECoreGL.Renderer()
+		r.setOption( "gl:mode", IECore.StringData( "deferred" ) )
+
+		with IECoreScene.WorldBlock( r ) :
+
+			r.setAttribute( "automaticInstancing", IECore.BoolData( automaticInstancing ) )
+			for i in range( 0, numMeshes ) :
+				r.concatTransform( imath.M44f().translate( imath.V3f( 1, 0, 0 ) ) )
+				m.render( r )
+
+		return r.scene()
+
+	def testConsecutivePrimitivesAreInstanced( self ) :
+
+		scene = self.__renderRepeatedMeshes( 10 )
+
+		self.assertEqual( len( scene.root().children() ), 1 )
+		group = scene.root().children()[0]
+		self.assertEqual( group.getTransform(), imath.M44f() )
+		self.assertEqual( len( group.children() ), 1 )
+
+		instancer = group.children()[0]
+		self.assertTrue( isinstance( instancer, IECoreGL.PrimitiveInstancer ) )
+		self.assertTrue( isinstance( instancer.primitive(), IECoreGL.MeshPrimitive ) )
+		self.assertEqual(
+			instancer.transforms(),
+			[ imath.M44f().translate( imath.V3f( i + 1, 0, 0 ) ) for i in range( 0, 10 ) ]
+		)
+
+		self.assertEqual( instancer.bound(), imath.Box3f( imath.V3f( 0.5, -0.5, -0.5 ), imath.V3f( 10.5, 0.5, 0.5 ) ) )
+		self.assertEqual( scene.bound(), instancer.bound() )
+
+		# Without automatic instancing, the primitives aren't identical
+		# and must be rendered individually.
+
+		scene = self.__renderRepeatedMeshes( 10, automaticInstancing = False )
+		self.assertEqual( len( scene.root().children() ), 10 )
+		self.assertEqual( scene.bound(), instancer.bound() )
+
+	def testStateChangesPreventInstancing( self ) :
+
+		m = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ) )
+
+		r = IECoreGL.Renderer()
+		r.setOption( "gl:mode", IECore.StringData( "deferred" ) )
+
+		with IECoreScene.WorldBlock( r ) :
+
+			m.render( r )
+			m.render( r )
+			r.setAttribute( "gl:primitive:wireframe", IECore.BoolData( True ) )
+			m.render( r )
+
+		children = r.scene().root().children()
+		self.assertEqual( len( children ), 2 )
+		self.assertTrue( isinstance( children[0].children()[0], IECoreGL.PrimitiveInstancer ) )
+		self.assertEqual( len( children[0].children()[0].transforms() ), 2 )
+		self.assertTrue( isinstance( children[1].children()[0], IECoreGL.MeshPrimitive ) )
+
+	def testPrimitivesInTransformBlocksAreInstanced( self ) :
+
+		m = IECoreScene.MeshPrimitive.createBox( imath.Box3f( imath.V3f( -0.5 ), imath.V3f( 0.5 ) ) )
+
+		r = IECoreGL.Renderer()
+		r.setOption( "gl:mode", IECore.StringData( "deferred" ) )
+
+		with IECoreScene.WorldBlock( r ) :
+
+			r.concatTransform( imath.M44f().translate( imath.V3f( 0, 1, 0 ) ) )
+			for i in range( 0, 3 ) :
+				with IECoreScene.TransformBlock( r ) :
+					r.concatTransform( imath.M44f().translate( imath.V3f( i, 0, 0 ) ) )
+					m.render( r )
+
+		instancers = []
+		self.__collectInstancers( r.scene().root(), instancers )
+		self.assertEqual( len( instancers ), 1 )
+		self.assertEqual(
+			instancers[0].transforms(),
+			[ imath.M44f().translate( imath.V3f( i, 1, 0 ) ) for i in range( 0, 3 ) ]
+		)
+		self.assertEqual( r.scene().bound(), imath.Box3f( imath.V3f( -0.5, 0.5, -0.5 ), imath.V3f( 2.5, 1.5, 0.5 ) ) )
+
+	def testBatchesAreInstanced( self ) :
+
+		m = IECoreScene.MeshPrimitive.createBox( imath.Box3f( imath.V3f( -0.5 ), imath.V3f( 0.5 ) ) )
+		transforms = [ imath.M44f().translate( imath.V3f( i, 0, 0 ) ) for i in range( 0, 10 ) ]
+
+		r = IECoreGL.Renderer()
+		r.instanceBegin( "box", {} )
+		r.concatTransform( imath.M44f().translate( imath.V3f( 0, 1, 0 ) ) )
+		m.render( r )
+		r.instanceEnd()
+
+		r.setOption( "gl:mode", IECore.StringData( "deferred" ) )
+
+		with IECoreScene.WorldBlock( r ) :
+			r.primitives( [ m ] * len( transforms ), transforms )
+			r.instances( "box", transforms )
+
+		instancers = []
+		self.__collectInstancers( r.scene().root(), instancers )
+		self.assertEqual( len( instancers ), 2 )
+		self.assertEqual( instancers[0].transforms(), transforms )
+		self.assertEqual(
+			instancers[1].transforms(),
+			[ imath.M44f().translate( imath.V3f( 0, 1, 0 ) ) * t for t in transforms ]
+		)
+
+	def __collectInstancers( self, group, instancers ) :
+
+		for c in group.children() :
+			if isinstance( c, IECoreGL.PrimitiveInstancer ) :
+				instancers.append( c )
+			elif isinstance( c, IECoreGL.Group ) :
+				self.__collectInstancers( c, instancers )
+
+	@unittest.skipUnless( os.environ.get( "CORTEX_PERFORMANCE_TEST", False ), "'CORTEX_PERFORMANCE_TEST' env var not set" )
+	def testRepeatedPrimitivePerformance( self ) :
+
+		for automaticInstancing in ( False, True ) :
+
+			scene = self.__renderRepeatedMeshes( 100000, automaticInstancing )
+
+			t = time.time()
+			for i in range( 0, 10 ) :
+				scene.render( IECoreGL.State( True ) )
+
+			print( "automaticInstancing {0} : {1:.3f}s".format( automaticInstancing, time.time() - t ) )
+
 if __name__ == "__main__":
     unittest.main()
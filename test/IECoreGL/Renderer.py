@@ -378,6 +378,8 @@ class TestRenderer( unittest.TestCase ) :
 		s.render( IECoreGL.State( True ) )
 
 	def __countChildrenRecursive( self, g ) :
+		if isinstance( g, IECoreGL.PrimitiveInstancer ) :
+			return len( g.transforms() )
 		if not isinstance( g, IECoreGL.Group ):
 			return 1
 		count = 0
@@ -854,6 +856,55 @@ class TestRenderer( unittest.TestCase ) :
 		self.assert_( g.bound().min().equalWithAbsError( imath.V3f( -1, 4, 9 ), 0.001 ) )
 		self.assert_( g.bound().max().equalWithAbsError( imath.V3f( 4, 11, 31 ), 0.001 ) )
 
+	def testBatchedPrimitivesAndInstances( self ) :
+
+		meshes = [
+			IECoreScene.MeshPrimitive.createBox( imath.Box3f( imath.V3f( -1 ), imath.V3f( 1 ) ) ),
+			IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ) ),
+			IECoreScene.PointsPrimitive( IECore.V3fVectorData( [ imath.V3f( 0 ) ] ) ),
+		] * 100
+		transforms = [ imath.M44f().translate( imath.V3f( i, 0, 0 ) ) for i in range( 0, len( meshes ) ) ]
+
+		def render( batched ) :
+
+			r = IECoreGL.Renderer()
+			r.instanceBegin( "box", {} )
+			meshes[0].render( r )
+			r.instanceEnd()
+
+			r.setOption( "gl:mode", IECore.StringData( "deferred" ) )
+			r.worldBegin()
+			r.concatTransform( imath.M44f().translate( imath.V3f( 0, 5, 0 ) ) )
+			if batched :
+				r.primitives( meshes, transforms )
+				r.primitives( meshes )
+				r.instances( "box", transforms )
+			else :
+				for m, t in zip( meshes, transforms ) :
+					r.transformBegin()
+					r.concatTransform( t )
+					m.render( r )
+					r.transformEnd()
+				for m in meshes :
+					m.render( r )
+				for t in transforms :
+					r.transformBegin()
+					r.concatTransform( t )
+					r.instance( "box" )
+					r.transformEnd()
+			r.worldEnd()
+
+			return r.scene().root()
+
+		individual = render( False )
+		batched = render( True )
+
+		self.assertEqual( self.__countChildrenRecursive( batched ), len( meshes ) * 3 )
+		self.assertEqual( self.__countChildrenRecursive( batched ), self.__countChildrenRecursive( individual ) )
+		self.assertEqual( batched.bound(), individual.bound() )
+		self.assertTrue( batched.bound().min().equalWithAbsError( imath.V3f( -1, 4, -1 ), 0.001 ) )
+		self.assertTrue( batched.bound().max().equalWithAbsError( imath.V3f( len( meshes ), 6, 1 ), 0.001 ) )
+
 	def testCuriousCrashOnThreadedProceduralsAndAttribute( self ):
 
 		myMesh = IECore.Reader.create( "test/IECore/data/cobFiles/pSphereShape1.cob").read()
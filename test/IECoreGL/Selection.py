@@ -32,6 +32,7 @@
 #
 ##########################################################################
 
+import time
 import unittest
 import inspect
 import os.path
@@ -126,6 +127,84 @@ class TestSelection( unittest.TestCase ) :
 		self.assertEqual( len( ss ), 1 )
 		self.assertEqual( IECoreGL.NameStateComponent.nameFromGLName( ss[0].name ), "white" )
 
+	def testBoundSelect( self ) :
+
+		r = IECoreGL.Renderer()
+		r.setOption( "gl:mode", IECore.StringData( "deferred" ) )
+
+		with IECoreScene.WorldBlock( r ) :
+
+			r.concatTransform( imath.M44f().translate( imath.V3f( 0, 0, -5 ) ) )
+
+			r.concatTransform( imath.M44f().translate( imath.V3f( -2, -2, 0 ) ) )
+			r.setAttribute( "name", IECore.StringData( "red" ) )
+			r.sphere( 1, -1, 1, 360, {} )
+
+			r.concatTransform( imath.M44f().translate( imath.V3f( 0, 4, 0 ) ) )
+			r.setAttribute( "name", IECore.StringData( "green" ) )
+			r.sphere( 1, -1, 1, 360, {} )
+
+			r.concatTransform( imath.M44f().translate( imath.V3f( 4, 0, 0 ) ) )
+			r.setAttribute( "name", IECore.StringData( "blue" ) )
+			r.sphere( 1, -1, 1, 360, {} )
+
+			r.concatTransform( imath.M44f().translate( imath.V3f( 0, -4, 0 ) ) )
+			r.setAttribute( "name", IECore.StringData( "white" ) )
+			r.sphere( 1, -1, 1, 360, {} )
+
+		s = r.scene()
+		s.setCamera( IECoreGL.Camera( imath.M44f(), False ) )
+
+		for region, name in [
+			( imath.Box2f( imath.V2f( 0, 0.5 ), imath.V2f( 0.5, 1 ) ), "red" ),
+			( imath.Box2f( imath.V2f( 0 ), imath.V2f( 0.5 ) ), "green" ),
+			( imath.Box2f( imath.V2f( 0.5, 0 ), imath.V2f( 1, 0.5 ) ), "blue" ),
+			( imath.Box2f( imath.V2f( 0.5 ), imath.V2f( 1 ) ), "white" ),
+		] :
+			ss = s.select( IECoreGL.Selector.Mode.Bound, region )
+			self.assertEqual( len( ss ), 1 )
+			self.assertEqual( IECoreGL.NameStateComponent.nameFromGLName( ss[0].name ), name )
+			self.assertGreaterEqual( ss[0].depthMin, 0 )
+			self.assertLessEqual( ss[0].depthMax, 1 )
+			self.assertLessEqual( ss[0].depthMin, ss[0].depthMax )
+
+		ss = s.select( IECoreGL.Selector.Mode.Bound, imath.Box2f( imath.V2f( 0 ), imath.V2f( 1 ) ) )
+		self.assertEqual(
+			set( [ IECoreGL.NameStateComponent.nameFromGLName( x.name ) for x in ss ] ),
+			{ "red", "green", "blue", "white" }
+		)
+
+		# Modifying the scene should invalidate the cached hierarchy.
+		s.root().clearChildren()
+		self.assertEqual( s.select( IECoreGL.Selector.Mode.Bound, imath.Box2f( imath.V2f( 0 ), imath.V2f( 1 ) ) ), [] )
+
+	@unittest.skipUnless( os.environ.get( "CORTEX_PERFORMANCE_TEST", False ), "'CORTEX_PERFORMANCE_TEST' env var not set" )
+	def testBoundSelectPerformance( self ) :
+
+		r = IECoreGL.Renderer()
+		r.setOption( "gl:mode", IECore.StringData( "deferred" ) )
+
+		mesh = IECoreScene.MeshPrimitive.createSphere( 0.01, divisions = imath.V2i( 20 ) )
+		with IECoreScene.WorldBlock( r ) :
+
+			r.concatTransform( imath.M44f().translate( imath.V3f( 0, 0, -5 ) ) )
+			for i in range( 0, 100 ) :
+				for j in range( 0, 100 ) :
+					with IECoreScene.AttributeBlock( r ) :
+						r.setAttribute( "name", IECore.StringData( "sphere{0}_{1}".format( i, j ) ) )
+						r.concatTransform( imath.M44f().translate( imath.V3f( i / 50.0 - 1, j / 50.0 - 1, 0 ) ) )
+						mesh.render( r )
+
+		s = r.scene()
+		s.setCamera( IECoreGL.Camera( imath.M44f(), False ) )
+
+		region = imath.Box2f( imath.V2f( 0.25 ), imath.V2f( 0.75 ) )
+		for mode in ( IECoreGL.Selector.Mode.IDRender, IECoreGL.Selector.Mode.Bound ) :
+			t = time.time()
+			for i in range( 0, 10 ) :
+				ss = s.select( mode, region )
+			print( "{0} : {1} hits in {2:.3f}s".format( mode, len( ss ), time.time() - t ) )
+
 	def testIDSelect( self ) :
 
 		r = IECoreGL.Renderer()
@@ -446,7 +525,7 @@ class TestSelection( unittest.TestCase ) :
 		s = r.scene()
 		s.setCamera( IECoreGL.Camera( imath.M44f(), False ) )
 
-		for mode in ( IECoreGL.Selector.Mode.GLSelect, IECoreGL.Selector.Mode.OcclusionQuery, IECoreGL.Selector.Mode.IDRender ) :
+		for mode in ( IECoreGL.Selector.Mode.GLSelect, IECoreGL.Selector.Mode.OcclusionQuery, IECoreGL.Selector.Mode.IDRender, IECoreGL.Selector.Mode.Bound ) :
 			ss = s.select( mode, imath.Box2f( imath.V2f( 0 ), imath.V2f( 1 ) ) )
 			names = [ IECoreGL.NameStateComponent.nameFromGLName( x.name ) for x in ss ]
 			self.assertEqual( names, [ "selectableObj" ] )
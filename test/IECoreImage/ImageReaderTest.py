@@ -182,6 +182,75 @@ class ImageReaderTest( unittest.TestCase ) :
 			cd = r.readChannel( c )
 			self.assertEqual( i[c], cd )
 
+	def testReadChannels( self ) :
+
+		r = IECoreImage.ImageReader( "test/IECoreImage/data/exr/manyChannels.exr" )
+
+		for raw in ( False, True ) :
+
+			names = [ "diffuse.blue", "R", "A", "diffuse.red" ]
+			channels = r.readChannels( names, raw = raw )
+			self.assertEqual( len( channels ), len( names ) )
+			for name, channel in zip( names, channels ) :
+				self.assertEqual( channel, r.readChannel( name, raw = raw ) )
+
+		self.assertEqual( r.readChannels( [] ), [] )
+		self.assertRaises( Exception, r.readChannels, [ "R", "notAChannel" ] )
+
+	def testReadRepeatedChannels( self ) :
+
+		r = IECoreImage.ImageReader( "test/IECoreImage/data/exr/manyChannels.exr" )
+
+		for names in ( [ "R", "R" ], [ "diffuse.red", "R", "diffuse.red", "R" ] ) :
+			channels = r.readChannels( names )
+			self.assertEqual( len( channels ), len( names ) )
+			for name, channel in zip( names, channels ) :
+				self.assertEqual( channel, r.readChannel( name ) )
+
+	def testDataWindowParameter( self ) :
+
+		r = IECoreImage.ImageReader( "test/IECoreImage/data/exr/uvMap.256x256.exr" )
+		full = r.read()
+
+		window = imath.Box2i( imath.V2i( 10, 20 ), imath.V2i( 99, 49 ) )
+		r["dataWindow"].setTypedValue( window )
+		i = r.read()
+
+		self.assertEqual( i.dataWindow, window )
+		self.assertEqual( i.displayWindow, full.displayWindow )
+		self.assertTrue( i.channelsValid() )
+
+		for c in [ "R", "G", "B" ] :
+			self.assertEqual( i[c], r.readChannel( c ) )
+			for y in range( window.min().y, window.max().y + 1 ) :
+				for x in range( window.min().x, window.max().x + 1, 7 ) :
+					self.assertEqual(
+						i[c][ ( y - window.min().y ) * 90 + x - window.min().x ],
+						full[c][ y * 256 + x ]
+					)
+
+	def testSharedCache( self ) :
+
+		limit = IECoreImage.ImageReader.getSharedCacheMemoryLimit()
+		try :
+
+			IECoreImage.ImageReader.setSharedCacheMemoryLimit( 100 )
+			self.assertEqual( IECoreImage.ImageReader.getSharedCacheMemoryLimit(), 100 )
+
+			r = IECoreImage.ImageReader( "test/IECoreImage/data/exr/manyChannels.exr" )
+			expected = r.read()
+
+			r["sharedCache"].setTypedValue( True )
+			self.assertEqual( r.read(), expected )
+
+			r2 = IECoreImage.ImageReader( "test/IECoreImage/data/exr/manyChannels.exr" )
+			r2["sharedCache"].setTypedValue( True )
+			self.assertEqual( r2.read(), expected )
+
+		finally :
+
+			IECoreImage.ImageReader.setSharedCacheMemoryLimit( limit )
+
 	def testNonZeroDataWindowOrigin( self ) :
 
 		r = IECoreImage.ImageReader( "test/IECoreImage/data/exr/uvMapWithDataWindow.100x100.exr" )
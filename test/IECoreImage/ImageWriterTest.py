@@ -291,6 +291,29 @@ class ImageWriterTest( unittest.TestCase ) :
 
 		self.__verifyImageRGB( imgNew, imgOrig )
 
+	def testWriteManyScanlines( self ) :
+
+		# Enough scanlines to need several chunks, with the last one partial.
+		dataWindow = imath.Box2i( imath.V2i( 3, -7 ), imath.V2i( 50, 600 ) )
+		displayWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( 63, 599 ) )
+
+		imgOrig = self.__makeFloatImage( dataWindow, displayWindow, withAlpha = True )
+
+		for fileName in ( "test/IECoreImage/data/exr/output.exr", "test/IECoreImage/data/tiff/output.tif" ) :
+
+			w = IECoreImage.ImageWriter( imgOrig, fileName )
+			w["formatSettings"]["tiff"]["dataType"].setValue( IECore.StringData( "float" ) )
+			w.write()
+
+			imgNew = IECore.Reader.create( fileName ).read()
+			if fileName.endswith( ".tif" ) :
+				# TIFF doesn't support data windows, so the data is
+				# cropped to the display window.
+				imgOrig = IECoreImage.ImageCropOp()( input = imgOrig, cropBox = displayWindow, matchDataWindow = True )
+
+			self.assertEqual( imgNew.dataWindow, imgOrig.dataWindow )
+			self.__verifyImageRGB( imgNew, imgOrig )
+
 	def testOversizeDataWindow( self ) :
 
 		r = IECore.Reader.create( "test/IECoreImage/data/exr/oversizeDataWindow.exr" )
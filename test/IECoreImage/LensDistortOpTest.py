@@ -68,3 +68,33 @@ class LensDistortOpTest(unittest.TestCase):
 
 		self.assertEqual( img.displayWindow, img2.displayWindow )
 
+	def testCachedDistortionMap( self ) :
+
+		o = IECore.CompoundObject()
+		o["lensModel"] = IECore.StringData( "StandardRadialLensModel" )
+		o["distortion"] = IECore.DoubleData( 0.2 )
+		o["curvatureX"] = IECore.DoubleData( 0.2 )
+
+		img = IECore.Reader.create( "test/IECoreImage/data/exr/uvMapWithDataWindow.100x100.exr" ).read()
+
+		op = IECoreImage.LensDistortOp()
+		op["input"] = img
+		op["lensModel"].setValue( o )
+
+		# The second operation reuses the distortion map
+		# computed by the first, and must give the same result.
+		out1 = op()
+		out2 = op()
+		self.assertEqual( out1, out2 )
+
+		# Changing the lens parameters must give a new map.
+		o["distortion"] = IECore.DoubleData( 0.3 )
+		op["lensModel"].setValue( o )
+		out3 = op()
+		self.assertNotEqual( out3, out1 )
+
+		# As must changing the mode.
+		op["mode"].setValue( op["mode"].getPresets()["Distort"] )
+		out4 = op()
+		self.assertNotEqual( out4, out3 )
+
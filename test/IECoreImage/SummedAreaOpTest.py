@@ -54,5 +54,20 @@ class SummedAreaOpTest( unittest.TestCase ) :
 		self.assertEqual( yy[2], 4 )
 		self.assertEqual( yy[3], 10 )
 
+	def testLargeImage( self ) :
+
+		b = imath.Box2i( imath.V2i( 10, 20 ), imath.V2i( 609, 419 ) )
+		i = IECoreImage.ImagePrimitive( b, b )
+		width = b.size().x + 1
+		height = b.size().y + 1
+		i["Y"] = IECore.FloatVectorData( [ ( x % 7 ) + ( y % 3 ) for y in range( 0, height ) for x in range( 0, width ) ] )
+
+		ii = IECoreImage.SummedAreaOp()( input=i, channels=IECore.StringVectorData( ["Y"] ) )
+
+		yy = ii["Y"]
+		for x, y in [ ( 0, 0 ), ( width - 1, 0 ), ( 0, height - 1 ), ( 123, 45 ), ( width - 1, height - 1 ) ] :
+			expected = sum( ( i % 7 ) + ( j % 3 ) for j in range( 0, y + 1 ) for i in range( 0, x + 1 ) )
+			self.assertEqual( yy[y * width + x], expected )
+
 if __name__ == "__main__":
     unittest.main()
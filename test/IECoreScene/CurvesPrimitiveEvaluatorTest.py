@@ -34,6 +34,7 @@
 
 from __future__ import with_statement
 
+import os
 import time
 import threading
 import math
@@ -1246,6 +1247,98 @@ class CurvesPrimitiveEvaluatorTest( unittest.TestCase ) :
 
 		IECoreScene.testCurvesPrimitiveEvaluatorParallelClosestPoint()
 
+	def testBatchPointsAtV( self ) :
+
+		rand = imath.Rand32()
+
+		for basis in ( IECore.CubicBasisf.linear(), IECore.CubicBasisf.bezier(), IECore.CubicBasisf.bSpline(), IECore.CubicBasisf.catmullRom() ) :
+			for periodic in ( False, True ) :
+
+				if periodic and basis == IECore.CubicBasisf.bezier() :
+					continue
+
+				p = IECore.V3fVectorData()
+				vertsPerCurve = IECore.IntVectorData()
+				for c in range( 0, 20 ) :
+					numVerts = 4 + basis.step * int( rand.nextf( 0, 5 ) )
+					vertsPerCurve.append( numVerts )
+					for i in range( 0, numVerts ) :
+						p.append( imath.V3f( rand.nextf(), rand.nextf(), rand.nextf() ) )
+
+				curves = IECoreScene.CurvesPrimitive( vertsPerCurve, basis, periodic, p )
+				e = IECoreScene.CurvesPrimitiveEvaluator( curves )
+				result = e.createResult()
+
+				curveIndices = IECore.IntVectorData()
+				v = IECore.FloatVectorData()
+				for c in range( 0, len( vertsPerCurve ) ) :
+					for i in range( 0, 50 ) :
+						curveIndices.append( c )
+						v.append( i / 49.0 )
+
+				points, tangents = e.pointsAtV( curveIndices, v )
+				self.assertEqual( len( points ), len( v ) )
+				self.assertEqual( len( tangents ), len( v ) )
+
+				for i in range( 0, len( v ) ) :
+					self.assertTrue( e.pointAtV( curveIndices[i], v[i], result ) )
+					self.assertTrue( points[i].equalWithAbsError( result.point(), 1e-6 ) )
+					self.assertTrue( tangents[i].equalWithAbsError( result.vTangent(), 1e-5 ) )
+
+		self.assertRaises( RuntimeError, e.pointsAtV, IECore.IntVectorData( [ 0 ] ), IECore.FloatVectorData( [ 0, 1 ] ) )
+		self.assertRaises( RuntimeError, e.pointsAtV, IECore.IntVectorData( [ 100 ] ), IECore.FloatVectorData( [ 0 ] ) )
+		self.assertRaises( RuntimeError, e.pointsAtV, IECore.IntVectorData( [ 0 ] ), IECore.FloatVectorData( [ 2 ] ) )
+
+	def testBatchClosestPoints( self ) :
+
+		rand = imath.Rand32()
+
+		for basis in ( IECore.CubicBasisf.linear(), IECore.CubicBasisf.catmullRom() ) :
+
+			p = IECore.V3fVectorData()
+			vertsPerCurve = IECore.IntVectorData()
+			for c in range( 0, 10 ) :
+				vertsPerCurve.append( 7 )
+				for i in range( 0, 7 ) :
+					p.append( imath.V3f( rand.nextf(), rand.nextf(), rand.nextf() ) + imath.V3f( c * 2 ) )
+
+			curves = IECoreScene.CurvesPrimitive( vertsPerCurve, basis, False, p )
+			e = IECoreScene.CurvesPrimitiveEvaluator( curves )
+			result = e.createResult()
+
+			queries = IECore.V3fVectorData( [ imath.V3f( rand.nextf( -1, 21 ) ) for i in range( 0, 1000 ) ] )
+			curveIndices, v = e.closestPoints( queries )
+
+			for i in range( 0, len( queries ) ) :
+				self.assertTrue( e.closestPoint( queries[i], result ) )
+				self.assertEqual( curveIndices[i], result.curveIndex() )
+				self.assertAlmostEqual( v[i], result.uv()[1], 5 )
+
+		e = IECoreScene.CurvesPrimitiveEvaluator( IECoreScene.CurvesPrimitive( IECore.IntVectorData(), IECore.CubicBasisf.linear(), False, IECore.V3fVectorData() ) )
+		self.assertEqual( e.closestPoints( IECore.V3fVectorData( [ imath.V3f( 0 ) ] ) ), None )
+
+	@unittest.skipUnless( os.environ.get("CORTEX_PERFORMANCE_TEST", False), "'CORTEX_PERFORMANCE_TEST' env var not set" )
+	def testBatchPerformance( self ) :
+
+		rand = imath.Rand32()
+
+		numCurves = 200000
+		p = IECore.V3fVectorData( [ imath.V3f( rand.nextf(), rand.nextf(), rand.nextf() ) for i in range( 0, numCurves * 4 ) ] )
+		curves = IECoreScene.CurvesPrimitive( IECore.IntVectorData( [ 4 ] * numCurves ), IECore.CubicBasisf.catmullRom(), False, p )
+
+		curveIndices = IECore.IntVectorData( [ i % numCurves for i in range( 0, 1000000 ) ] )
+		v = IECore.FloatVectorData( [ rand.nextf() for i in range( 0, 1000000 ) ] )
+
+		e = IECoreScene.CurvesPrimitiveEvaluator( curves )
+
+		t = IECore.Timer()
+		e.pointsAtV( curveIndices, v )
+		print( "pointsAtV : {0:.3f}s".format( t.stop() ) )
+
+		t = IECore.Timer()
+		e.closestPoints( IECore.V3fVectorData( p[:100000] ) )
+		print( "closestPoints (including tree build) : {0:.3f}s".format( t.stop() ) )
+
 if __name__ == "__main__":
 	unittest.main()
 
@@ -32,8 +32,10 @@
 #
 ##########################################################################
 
+import os
 import unittest
 import threading
+import imath
 
 import IECore
 import IECoreScene
@@ -96,5 +98,75 @@ class FontTest( unittest.TestCase ) :
 		for thread in threads :
 			thread.join()
 
+	def testCurveTolerance( self ) :
+
+		f = IECoreScene.Font( "test/IECore/data/fonts/Vera.ttf" )
+		m1 = f.mesh( "o" )
+
+		f.setCurveTolerance( f.getCurveTolerance() / 10.0 )
+		m2 = f.mesh( "o" )
+
+		self.assertGreater( m2["P"].data.size(), m1["P"].data.size() )
+
+	def testUnicode( self ) :
+
+		f = IECoreScene.Font( "test/IECore/data/fonts/Vera.ttf" )
+
+		e = f.mesh( "e" )
+		# Strings are UTF-8 encoded.
+		eAcute = f.mesh( u"\u00e9".encode( "utf-8" ) )
+
+		self.assertGreater( eAcute.numFaces(), 0 )
+		self.assertNotEqual( e, eAcute )
+		self.assertGreater( f.bound( u"\u00e9".encode( "utf-8" ) ).max().y, f.bound( "e" ).max().y )
+		self.assertEqual( f.mesh( u"\u00e9\u00e9".encode( "utf-8" ) )["P"].data.size(), 2 * eAcute["P"].data.size() )
+
+	def testBatchMesh( self ) :
+
+		f = IECoreScene.Font( "test/IECore/data/fonts/Vera.ttf" )
+
+		texts = [ "hello", "world", "", "AVA" ]
+		origins = [ imath.V2f( 0, -i * 2 ) for i in range( 0, len( texts ) ) ]
+
+		m = f.mesh( texts, origins )
+		self.assertTrue( m.arePrimitiveVariablesValid() )
+		self.assertEqual( set( m.keys() ), { "P", "N" } )
+		self.assertEqual( m["N"].interpolation, IECoreScene.PrimitiveVariable.Interpolation.Varying )
+
+		numFaces = 0
+		numPoints = 0
+		bound = imath.Box2f()
+		for text, origin in zip( texts, origins ) :
+			mm = f.mesh( text )
+			numFaces += mm.numFaces()
+			numPoints += mm["P"].data.size()
+			b = f.bound( text )
+			if not b.isEmpty() :
+				bound.extendBy( b.min() + origin )
+				bound.extendBy( b.max() + origin )
+
+		self.assertEqual( m.numFaces(), numFaces )
+		self.assertEqual( m["P"].data.size(), numPoints )
+
+		b = m.bound()
+		self.assertTrue( imath.V2f( b.min().x, b.min().y ).equalWithAbsError( bound.min(), 1e-5 ) )
+		self.assertTrue( imath.V2f( b.max().x, b.max().y ).equalWithAbsError( bound.max(), 1e-5 ) )
+
+		self.assertEqual( f.mesh( [ "hello world" ], [ imath.V2f( 0 ) ] ), f.mesh( "hello world" ) )
+		self.assertRaises( Exception, f.mesh, [ "a", "b" ], [ imath.V2f( 0 ) ] )
+
+	@unittest.skipUnless( os.environ.get("CORTEX_PERFORMANCE_TEST", False), "'CORTEX_PERFORMANCE_TEST' env var not set" )
+	def testBatchMeshPerformance( self ) :
+
+		texts = [ "The quick brown fox jumps over the lazy dog {0}".format( i ) for i in range( 0, 10000 ) ]
+		origins = [ imath.V2f( 0, -i ) for i in range( 0, len( texts ) ) ]
+
+		f = IECoreScene.Font( "test/IECore/data/fonts/Vera.ttf" )
+		f.setCurveTolerance( 0.001 )
+
+		t = IECore.Timer()
+		f.mesh( texts, origins )
+		print( "\nBatch mesh : {0:.3f}s".format( t.stop() ) )
+
 if __name__ == "__main__":
     unittest.main()
@@ -436,6 +436,28 @@ class TestMeshPrimitiveEvaluator( unittest.TestCase ) :
 					m["faceVarying"].data[m["faceVarying"].indices[triangleIndex*3+corner]]
 				)
 
+	def testBatchQueries( self ) :
+
+		m = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ), imath.V2i( 10 ) )
+		e = IECoreScene.PrimitiveEvaluator.create( m )
+
+		r = random.Random( 1 )
+		points = IECore.V3fVectorData( [ imath.V3f( r.uniform( -2, 2 ), r.uniform( -2, 2 ), r.uniform( -2, 2 ) ) for i in range( 0, 1000 ) ] )
+
+		distances = e.signedDistances( points )
+		positions, normals = e.closestPointsAndNormals( points )
+
+		self.assertEqual( len( distances ), len( points ) )
+		self.assertEqual( len( positions ), len( points ) )
+		self.assertEqual( len( normals ), len( points ) )
+
+		result = e.createResult()
+		for i, p in enumerate( points ) :
+			self.assertEqual( distances[i], e.signedDistance( p, result ) )
+			self.assertTrue( e.closestPoint( p, result ) )
+			self.assertEqual( positions[i], result.point() )
+			self.assertEqual( normals[i], result.normal() )
+
 if __name__ == "__main__":
 	unittest.main()
 
@@ -38,6 +38,7 @@ import unittest
 import sys
 import os
 
+import imath
 import IECore
 import IECoreScene
 
@@ -338,6 +339,67 @@ class TestPDCReader( unittest.TestCase ) :
 		self.assertEqual( len( c.messages ), 1 )
 		self.assertEqual( c.messages[0].level, IECore.Msg.Level.Warning )
 
+	def testLargeRoundTrip( self ) :
+
+		# Enough particles to span several of the blocks used
+		# for conversion and byte swapping.
+		n = 5000
+		p = IECoreScene.PointsPrimitive( IECore.V3fVectorData( [ imath.V3f( i, i + 0.5, -i ) for i in range( 0, n ) ] ) )
+		p["f"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.FloatVectorData( [ i * 0.25 for i in range( 0, n ) ] ) )
+		p["i"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.IntVectorData( list( range( 0, n ) ) ) )
+		IECore.Writer.create( p, "test/particleShape1.250.pdc" ).write()
+
+		r = IECoreScene.PDCParticleReader( "test/particleShape1.250.pdc" )
+		r["attributes"].setValue( IECore.StringVectorData( [ "P", "f" ] ) )
+		p2 = r.read()
+
+		self.assertEqual( set( p2.keys() ), set( [ "P", "f" ] ) )
+		self.assertEqual( p2["P"].data, p["P"].data )
+		self.assertEqual( p2["f"].data, p["f"].data )
+
+		r["attributes"].setValue( IECore.StringVectorData() )
+		r["realType"].setValue( "native" )
+		p3 = r.read()
+		self.assertEqual( p3["i"].data, p["i"].data )
+		self.assertEqual( p3["P"].data, IECore.V3dVectorData( [ imath.V3d( v.x, v.y, v.z ) for v in p["P"].data ] ) )
+
+	def testTruncatedFile( self ) :
+
+		p = IECoreScene.PointsPrimitive( IECore.V3fVectorData( [ imath.V3f( i ) for i in range( 0, 100 ) ] ) )
+		IECore.Writer.create( p, "test/particleShape1.250.pdc" ).write()
+
+		with open( "test/particleShape1.250.pdc", "rb" ) as f :
+			data = f.read()
+		with open( "test/particleShape1.250.pdc", "wb" ) as f :
+			f.write( data[:len( data ) // 2] )
+
+		r = IECoreScene.PDCParticleReader( "test/particleShape1.250.pdc" )
+		self.assertEqual( r.numParticles(), 0 )
+		self.assertEqual( r.attributeNames(), [] )
+
+	@unittest.skipUnless( os.environ.get( "CORTEX_PERFORMANCE_TEST", False ), "'CORTEX_PERFORMANCE_TEST' env var not set" )
+	def testSelectiveReadPerformance( self ) :
+
+		n = 1000000
+		p = IECoreScene.PointsPrimitive( n )
+		p["P"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.V3fVectorData( [ imath.V3f( 1 ) ] * n ) )
+		for i in range( 0, 10 ) :
+			p["attr%d" % i] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.V3fVectorData( [ imath.V3f( i ) ] * n ) )
+		IECore.Writer.create( p, "test/particleShape1.250.pdc" ).write()
+
+		r = IECoreScene.PDCParticleReader( "test/particleShape1.250.pdc" )
+
+		t = IECore.Timer()
+		r.read()
+		print( "All attributes : %f" % t.stop() )
+
+		r = IECoreScene.PDCParticleReader( "test/particleShape1.250.pdc" )
+		r["attributes"].setValue( IECore.StringVectorData( [ "P" ] ) )
+
+		t = IECore.Timer()
+		r.read()
+		print( "Position only : %f" % t.stop() )
+
 	def tearDown( self ) :
 
 		if os.path.isfile( "test/particleShape1.250.pdc" ) :
@@ -164,10 +164,40 @@ class SceneAlgoTest( unittest.TestCase ) :
 				self.assertEqual(stats["curves"], 0)
 				self.assertEqual(stats["points"], 0)
 				self.assertEqual(stats["tags"], 4096 ) # default tag for polygon mesh
-				self.assertEqual(stats["sets"], 0)
+				self.assertEqual(stats["sets"], len( src.setNames() ) )
 				self.assertEqual(stats["attributes"], 4096 * 2 )  # default attribute & custom attribute 'foo'
 
 
+	def testParallelFrames( self ) :
+
+		m = IECoreScene.SceneCache( SceneAlgoTest.__testFile, IECore.IndexedIO.OpenMode.Write )
+		t = m.createChild( "t" )
+		for i in range( 0, 100 ) :
+			c = t.createChild( "c{0}".format( i ) )
+			for f in range( 1, 11 ) :
+				box = IECoreScene.MeshPrimitive.createBox( imath.Box3f( imath.V3f( -f ), imath.V3f( f ) ) )
+				c.writeObject( box, f )
+				c.writeAttribute( "foo", IECore.IntData( f ), f )
+		del c, t, m
+
+		src = IECoreScene.SceneCache( SceneAlgoTest.__testFile, IECore.IndexedIO.OpenMode.Read )
+
+		serialStats = IECoreScene.SceneAlgo.parallelReadAll( src, 1, 10, 1.0, IECoreScene.SceneAlgo.ProcessFlags.All, parallelFrames = False )
+		parallelStats = IECoreScene.SceneAlgo.parallelReadAll( src, 1, 10, 1.0, IECoreScene.SceneAlgo.ProcessFlags.All, parallelFrames = True )
+
+		for stats in ( serialStats, parallelStats ) :
+			self.assertEqual( stats["frames"], 10 )
+			self.assertEqual( stats["locations"], 102 * 10 )
+			self.assertEqual( stats["polygons"], 100 * 6 * 10 )
+			self.assertGreater( stats["objectBytes"], 0 )
+			self.assertGreater( stats["attributeBytes"], 0 )
+			self.assertGreater( stats["time"], 0 )
+			self.assertGreater( stats["objectsTime"], 0 )
+
+		for key in serialStats.keys() :
+			if not key.endswith( "Time" ) and key != "time" :
+				self.assertEqual( serialStats[key], parallelStats[key] )
+
 
 if __name__ == "__main__" :
 	unittest.main()
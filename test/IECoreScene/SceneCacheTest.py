@@ -33,6 +33,7 @@
 ##########################################################################
 
 import gc
+import os
 import sys
 import math
 import unittest
@@ -1125,6 +1126,203 @@ class SceneCacheTest( unittest.TestCase ) :
 
 		IECoreScene.testSceneCacheParallelFakeAttributeRead()
 
+	def testBatchReads( self ) :
+
+		box = IECoreScene.MeshPrimitive.createBox( imath.Box3f( imath.V3f( 0 ), imath.V3f( 1 ) ) )
+
+		s = IECoreScene.SceneCache( "/tmp/test.scc", IECore.IndexedIO.OpenMode.Write )
+		t = s.createChild( "t" )
+		for i in range( 0, 10 ) :
+			m = imath.Eulerd( 0, i * 0.1, 0 ).toMatrix44()
+			m[3][0] = i
+			t.writeTransform( IECore.M44dData( m ), i )
+			box2 = box.copy()
+			box2["P"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.V3fVectorData( [ p + imath.V3f( i ) for p in box["P"].data ] ) )
+			t.writeObject( box2, i )
+
+		del s, t
+
+		s = IECoreScene.SceneCache( "/tmp/test.scc", IECore.IndexedIO.OpenMode.Read )
+		t = s.child( "t" )
+
+		times = [ -1, 0, 0.25, 1, 3.5, 3.5, 9, 12 ]
+
+		bounds = t.readBounds( times )
+		self.assertTrue( isinstance( bounds, IECore.Box3dVectorData ) )
+		self.assertEqual( list( bounds ), [ t.readBound( x ) for x in times ] )
+
+		transforms = t.readTransformsAsMatrices( times )
+		self.assertTrue( isinstance( transforms, IECore.M44dVectorData ) )
+		self.assertEqual( list( transforms ), [ t.readTransformAsMatrix( x ) for x in times ] )
+
+		primVars = t.readObjectPrimitiveVariablesAtTimes( [ "P" ], times )
+		self.assertEqual( len( primVars ), len( times ) )
+		for x, v in zip( times, primVars ) :
+			self.assertEqual( v, t.readObjectPrimitiveVariables( [ "P" ], x ) )
+
+		self.assertEqual( len( t.readBounds( [] ) ), 0 )
+		self.assertEqual( len( s.readTransformsAsMatrices( times ) ), len( times ) )
+
+	def testSharedObjectData( self ) :
+
+		plane = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ), imath.V2i( 100 ) )
+		plane["constant"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Constant, IECore.StringData( "shared" ) )
+
+		meshes = []
+		for i in range( 0, 3 ) :
+			m = plane.copy()
+			m["P"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.V3fVectorData( [ p + imath.V3f( 0, 0, i ) for p in plane["P"].data ] ) )
+			meshes.append( m )
+
+		for fileName in ( "/tmp/test.scc", "/tmp/test2.scc" ) :
+			s = IECoreScene.SceneCache( fileName, IECore.IndexedIO.OpenMode.Write )
+			for name in ( "a", "b" ) :
+				c = s.createChild( name )
+				for i, m in enumerate( meshes ) :
+					c.writeObject( m, i )
+			del s, c
+
+		def readAll() :
+
+			for fileName in ( "/tmp/test.scc", "/tmp/test2.scc" ) :
+				s = IECoreScene.SceneCache( fileName, IECore.IndexedIO.OpenMode.Read )
+				for name in ( "a", "b" ) :
+					c = s.child( name )
+					for i, m in enumerate( meshes ) :
+						self.assertEqual( c.readObjectAtSample( i ), m )
+
+		# Sharing is off by default, so nothing should be saved.
+
+		self.assertFalse( IECoreScene.SceneCache.getObjectDataSharingEnabled() )
+		memorySaved = IECoreScene.SceneCache.objectDataMemorySaved()
+		readAll()
+		self.assertEqual( IECoreScene.SceneCache.objectDataMemorySaved(), memorySaved )
+
+		IECoreScene.SceneCache.setObjectDataSharingEnabled( True )
+		try :
+			defaultPoolMemory = IECore.ObjectPool.defaultObjectPool().memoryUsage()
+			readAll()
+		finally :
+			IECoreScene.SceneCache.setObjectDataSharingEnabled( False )
+
+		# Topology, uvs and constant primitive variables should have been
+		# shared by all locations after the first, using a pool private to
+		# SceneCache.
+		self.assertGreaterEqual(
+			IECoreScene.SceneCache.objectDataMemorySaved() - memorySaved,
+			3 * ( plane.verticesPerFace.memoryUsage() + plane.vertexIds.memoryUsage() + plane["uv"].data.memoryUsage() )
+		)
+		self.assertGreater( IECoreScene.SceneCache.objectDataPool().memoryUsage(), 0 )
+		self.assertEqual( IECore.ObjectPool.defaultObjectPool().memoryUsage(), defaultPoolMemory )
+
+		os.remove( "/tmp/test2.scc" )
+
+	def testColumnLayout( self ) :
+
+		plane = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ), imath.V2i( 10 ) )
+		plane["constant"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Constant, IECore.StringData( "constant" ) )
+
+		# Enough samples to span several blocks
+		meshes = []
+		for i in range( 0, 70 ) :
+			m = plane.copy()
+			m["P"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.V3fVectorData( [ p + imath.V3f( 0, 0, i ) for p in plane["P"].data ], IECore.GeometricData.Interpretation.Point ) )
+			m["Cs"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Uniform, IECore.Color3fVectorData( [ imath.Color3f( i ) ] * m.numFaces() ) )
+			meshes.append( m )
+
+		for fileName, layout in ( ( "/tmp/test.scc", IECoreScene.SceneCache.ObjectLayout.ColumnLayout ), ( "/tmp/test2.scc", IECoreScene.SceneCache.ObjectLayout.SampleLayout ) ) :
+			s = IECoreScene.SceneCache( fileName, IECore.IndexedIO.OpenMode.Write )
+			self.assertEqual( s.getObjectLayout(), IECoreScene.SceneCache.ObjectLayout.SampleLayout )
+			c = s.createChild( "c" )
+			c.setObjectLayout( layout )
+			self.assertEqual( s.getObjectLayout(), layout )
+			for i, m in enumerate( meshes ) :
+				c.writeObject( m, i )
+			s.createChild( "empty" )
+			del s, c
+
+		columns = IECoreScene.SceneCache( "/tmp/test.scc", IECore.IndexedIO.OpenMode.Read )
+		samples = IECoreScene.SceneCache( "/tmp/test2.scc", IECore.IndexedIO.OpenMode.Read )
+
+		self.assertEqual( columns.child( "c" ).getObjectLayout(), IECoreScene.SceneCache.ObjectLayout.ColumnLayout )
+		self.assertEqual( columns.child( "empty" ).getObjectLayout(), IECoreScene.SceneCache.ObjectLayout.SampleLayout )
+		self.assertEqual( samples.child( "c" ).getObjectLayout(), IECoreScene.SceneCache.ObjectLayout.SampleLayout )
+
+		c = columns.child( "c" )
+		for i, m in enumerate( meshes ) :
+			self.assertEqual( c.readObjectAtSample( i ), m )
+			self.assertEqual( c.readObjectPrimitiveVariables( [ "P", "Cs", "constant" ], i ), { k : m[k] for k in ( "P", "Cs", "constant" ) } )
+
+		times = [ i * 0.25 for i in range( 0, 280 ) ]
+		names = [ "P", "Cs", "uv", "missing" ]
+		self.assertEqual(
+			c.readObjectPrimitiveVariablesAtTimes( names, times ),
+			samples.child( "c" ).readObjectPrimitiveVariablesAtTimes( names, times )
+		)
+		for t in ( 0.5, 31.5, 65.25 ) :
+			self.assertEqual( c.readObject( t ), samples.child( "c" ).readObject( t ) )
+			self.assertEqual( c.readObjectPrimitiveVariables( names, t ), samples.child( "c" ).readObjectPrimitiveVariables( names, t ) )
+
+		os.remove( "/tmp/test2.scc" )
+
+	@unittest.skipUnless( os.environ.get( "CORTEX_PERFORMANCE_TEST", False ), "'CORTEX_PERFORMANCE_TEST' env var not set" )
+	def testColumnLayoutPerformance( self ) :
+
+		plane = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ), imath.V2i( 200 ) )
+		numSamples = 200
+
+		for fileName, layout in ( ( "/tmp/test.scc", IECoreScene.SceneCache.ObjectLayout.SampleLayout ), ( "/tmp/test2.scc", IECoreScene.SceneCache.ObjectLayout.ColumnLayout ) ) :
+			s = IECoreScene.SceneCache( fileName, IECore.IndexedIO.OpenMode.Write )
+			s.setObjectLayout( layout )
+			c = s.createChild( "c" )
+			for i in range( 0, numSamples ) :
+				m = plane.copy()
+				m["P"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.V3fVectorData( [ p + imath.V3f( 0, 0, i ) for p in plane["P"].data ] ) )
+				c.writeObject( m, i )
+			del s, c
+
+		times = range( 0, numSamples )
+		for fileName, layout in ( ( "/tmp/test.scc", "Sample" ), ( "/tmp/test2.scc", "Column" ) ) :
+
+			c = IECoreScene.SceneCache( fileName, IECore.IndexedIO.OpenMode.Read ).child( "c" )
+			timer = IECore.Timer()
+			c.readObjectPrimitiveVariablesAtTimes( [ "P" ], times )
+			print( "%s layout, P over frame range : %f" % ( layout, timer.stop() ) )
+
+			c = IECoreScene.SceneCache( fileName, IECore.IndexedIO.OpenMode.Read ).child( "c" )
+			timer = IECore.Timer()
+			for t in times :
+				c.readObject( t )
+			print( "%s layout, individual objects : %f" % ( layout, timer.stop() ) )
+
+		os.remove( "/tmp/test2.scc" )
+
+	@unittest.skipUnless( os.environ.get( "CORTEX_PERFORMANCE_TEST", False ), "'CORTEX_PERFORMANCE_TEST' env var not set" )
+	def testBatchReadPerformance( self ) :
+
+		s = IECoreScene.SceneCache( "/tmp/test.scc", IECore.IndexedIO.OpenMode.Write )
+		t = s.createChild( "t" )
+		for i in range( 0, 500 ) :
+			t.writeTransform( IECore.M44dData( imath.M44d().translate( imath.V3d( i ) ) ), i )
+			t.writeBound( imath.Box3d( imath.V3d( i ), imath.V3d( i + 1 ) ), i )
+
+		del s, t
+
+		times = [ i * 0.5 for i in range( 0, 1000 ) ]
+
+		t = IECoreScene.SceneCache( "/tmp/test.scc", IECore.IndexedIO.OpenMode.Read ).child( "t" )
+		timer = IECore.Timer()
+		for x in times :
+			t.readBound( x )
+			t.readTransformAsMatrix( x )
+		print( "Individual reads : %f" % timer.stop() )
+
+		t = IECoreScene.SceneCache( "/tmp/test.scc", IECore.IndexedIO.OpenMode.Read ).child( "t" )
+		timer = IECore.Timer()
+		t.readBounds( times )
+		t.readTransformsAsMatrices( times )
+		print( "Batch reads : %f" % timer.stop() )
+
 	def testCanReadV6SceneCache( self ):
 
 		r = IECore.IndexedIO.create("test/IECore/data/sccFiles/cube_v6.scc", IECore.IndexedIO.OpenMode.Read)
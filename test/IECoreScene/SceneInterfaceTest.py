@@ -108,6 +108,25 @@ class SceneInterfaceTest( unittest.TestCase ) :
 		self.assertFalse( instance4.isSame( instance1 ) )
 		self.assertTrue( instance4.isSame( instance3 ) )
 
+	def testReadObjects( self ) :
+
+		self.writeSCC()
+
+		m = IECoreScene.SceneInterface.create( SceneInterfaceTest.__testFile, IECore.IndexedIO.OpenMode.Read )
+		objects = m.readObjects( [ [ "t", "s" ], [ "t" ], [] ], 1.0 )
+
+		self.assertEqual( len( objects ), 3 )
+		self.assertEqual( objects[0], m.scene( [ "t", "s" ] ).readObject( 1.0 ) )
+		self.assertEqual( objects[1], None )
+		self.assertEqual( objects[2], None )
+
+		self.assertRaises( RuntimeError, m.readObjects, [ [ "t", "notHere" ] ], 1.0 )
+
+		# LinkedScene isn't known to support concurrent reads, so is read serially.
+		l = IECoreScene.LinkedScene( m )
+		self.assertEqual( l.readObjects( [ [ "t", "s" ], [ "t" ] ], 1.0 ), [ objects[0], None ] )
+		self.assertRaises( RuntimeError, l.readObjects, [ [ "t", "notHere" ] ], 1.0 )
+
 	def testVisibilityName( self ) :
 		self.assertEqual( IECoreScene.SceneInterface.visibilityName, "scene:visible" )
 
@@ -122,6 +122,19 @@ class TestTransformOp( unittest.TestCase ) :
 		self.assertNotEqual( ms["vel"].data, ms["otherVel"].data )
 		self.assertEqual( ms["otherVel"].data, m["otherVel"].data )
 
+	def testUnmodifiedPrimVarsAreShared( self ) :
+
+		m = IECoreScene.MeshPrimitive.createBox( imath.Box3f( imath.V3f( -1 ), imath.V3f( 1 ) ) )
+		m["Cs"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.Color3fVectorData( [ imath.Color3f( 0.5 ) ] * 8 ) )
+		p = m["P"].data.copy()
+
+		mt = IECoreScene.TransformOp()( input = m, primVarsToModify = IECore.StringVectorData( [ "P" ] ), matrix = IECore.M44fData( imath.M44f().translate( imath.V3f( 1 ) ) ) )
+
+		self.assertEqual( m["P"].data, p )
+		self.assertNotEqual( mt["P"].data, p )
+		self.assertFalse( mt["P"].data.isSame( m["P"].data ) )
+		self.assertTrue( mt["Cs"].data.isSame( m["Cs"].data ) )
+
 if __name__ == "__main__":
 	unittest.main()
 